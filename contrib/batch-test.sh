@@ -0,0 +1,80 @@
+#!/bin/sh
+# Check that each query of eix --batch prints the same as the query alone.
+# Usage: batch-test.sh [eix options] [-- batchfile]
+# If no batchfile is given, a default list of queries is used which
+# exercise the installed versions and the stability of the packages.
+#
+# This file is part of the eix project and distributed under the
+# terms of the GNU General Public License v2.
+#
+# Copyright (c)
+#   Martin Väth <martin@mvath.de>
+
+die() {
+	echo "!!! failed $*"
+	exit 1
+}
+
+eix=${0%/*}/../src/eix
+tmpdir=$(mktemp -d) || die mktemp
+
+cleanup() {
+	trap : INT HUP TERM
+	rm -rf -- "$tmpdir"
+	trap - INT HUP TERM
+}
+
+trap cleanup INT HUP TERM
+
+opts=
+batchfile=
+while [ $# -gt 0 ]
+do	if [ x"$1" = x"--" ]
+	then	batchfile=$2
+		break
+	fi
+	opts="$opts $1"
+	shift
+done
+if [ -z "$batchfile" ]
+then	batchfile=$tmpdir/queries
+	cat >"$batchfile" <<'EOF'
+-I
+--installed-slot -r .
+-u
+--stable
+--testing
+--non-masked -I
+--installed-unstable
+-T
+-I --installed-with-use .
+--installed-fullslot -r .
+-i
+--upgrade+
+EOF
+fi
+
+# split the batch output at the "# query" lines into b1, b2, ...
+"$eix" $opts --batch "$batchfile" >"$tmpdir/batch" 2>&1 || :
+awk -v d="$tmpdir" '/^# /{n++; f=d"/b"n; next} {print > f}' "$tmpdir/batch"
+
+n=0
+bad=0
+while IFS= read -r query
+do	case $query in
+	''|'#'*)
+		continue;;
+	esac
+	n=$(( $n + 1 ))
+	eval "\"\$eix\" $opts $query" >"$tmpdir/s$n" 2>&1
+	[ -f "$tmpdir/b$n" ] || : >"$tmpdir/b$n"
+	if ! cmp -s -- "$tmpdir/b$n" "$tmpdir/s$n"
+	then	echo "!!! query differs: $query"
+		diff -- "$tmpdir/b$n" "$tmpdir/s$n"
+		bad=$(( $bad + 1 ))
+	fi
+done <"$batchfile"
+
+cleanup
+echo "$bad of $n queries differ"
+[ $bad -eq 0 ]
@@ -0,0 +1,141 @@
+#!/bin/sh
+# Compare StringMatcher of ../src/eixTk with a plain byte by byte
+# implementation for random strings, once with the SSE2 kernels and once
+# with the loops used without SSE2.
+# Usage: stringmatch-test.sh [directory of config.h] [compiler options]
+# The default directory is .. (the top of an in-tree build).
+# If SSE2 is not available, the test is skipped (exit status 77).
+#
+# This file is part of the eix project and distributed under the
+# terms of the GNU General Public License v2.
+#
+# Copyright (c)
+#   Martin Väth <martin@mvath.de>
+
+die() {
+	echo "!!! failed $*"
+	exit 1
+}
+
+top=${0%/*}/..
+config=${1:-$top}
+[ $# -gt 0 ] && shift
+: ${CXX:=g++}
+tmpdir=$(mktemp -d) || die mktemp
+
+cleanup() {
+	trap : INT HUP TERM
+	rm -rf -- "$tmpdir"
+	trap - INT HUP TERM
+}
+
+trap cleanup INT HUP TERM
+
+[ -r "$config/config.h" ] || die "no config.h in $config"
+
+cat >"$tmpdir/test.cc" <<'EOF'
+#include <config.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include <iostream>
+#include <string>
+
+#include "eixTk/stringmatch.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+// Bytes around the ASCII letters and above 0x7F are used deliberately
+static const char alphabet[] = "aAbBzZ@[`{\x80\xc1\xe1\xff";
+
+static char lower(char c) {
+	return (((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c | 0x20) : c);
+}
+
+static bool same(const char *s, const string& p, bool icase) {
+	for(string::size_type i(0); i != p.size(); ++i) {
+		if(icase ? (lower(s[i]) != lower(p[i])) : (s[i] != p[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static string random_string(string::size_type len) {
+	string s;
+	for(; len != 0; --len) {
+		s.append(1, alphabet[std::rand() % (sizeof(alphabet) - 1)]);
+	}
+	return s;
+}
+
+int main() {
+#if defined(HAVE_EMMINTRIN_H) && defined(__SSE2__)
+	cout << "SSE2" << endl;
+#else
+	cout << "plain" << endl;
+#endif
+	std::srand(1);
+	unsigned long bad(0);
+	for(unsigned long trial(0); trial != 200000; ++trial) {
+		bool icase((trial & 1) != 0);
+		string s(random_string(std::rand() % 80));
+		string p;
+		string::size_type n(1 + std::rand() % 40);
+		if((std::rand() % 2 != 0) && (n <= s.size())) {
+			// Take the pattern from s to get matches, maybe in another case
+			p.assign(s, std::rand() % (s.size() - n + 1), n);
+			for(string::iterator it(p.begin()); icase && (it != p.end()); ++it) {
+				if((std::rand() % 2 != 0) && (((*it) | 0x20) >= 'a') && (((*it) | 0x20) <= 'z')) {
+					*it = static_cast<char>((*it) ^ 0x20);
+				}
+			}
+		} else {
+			p = random_string(n);
+		}
+		StringMatcher m;
+		m.set_pattern(p, icase);
+		const char *c(s.c_str());
+		bool contains(false);
+		for(string::size_type i(0); (!contains) && (i + n <= s.size()); ++i) {
+			contains = same(c + i, p, icase);
+		}
+		bool begins((n <= s.size()) && same(c, p, icase));
+		bool ends((n <= s.size()) && same(c + (s.size() - n), p, icase));
+		bool equal(begins && (n == s.size()));
+		if((m.contains(c) != contains) || (m.begins(c) != begins) ||
+			(m.ends(c) != ends) || (m.equal(c) != equal)) {
+			if(++bad <= 10) {
+				cout << "mismatch: \"" << s << "\" \"" << p << "\" icase " << icase << endl;
+			}
+		}
+	}
+	return ((bad == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+EOF
+
+# The first build uses SSE2 (if available), the second one does not
+status=0
+for variant in sse2 plain
+do	flags=
+	[ $variant = plain ] && flags=-U__SSE2__
+	"$CXX" -DHAVE_CONFIG_H -I"$config" -I"$top/src" "$@" $flags \
+		-o "$tmpdir/test-$variant" "$tmpdir/test.cc" \
+		"$top/src/eixTk/stringmatch.cc" || die "compiling $variant"
+	result=$("$tmpdir/test-$variant") || {
+		echo "$result"
+		die "$variant"
+	}
+	kernel=${result%%
+*}
+	echo "$variant: $kernel kernels agree with the reference"
+	if [ $variant = sse2 ] && [ x"$kernel" != x"SSE2" ]
+	then	echo "SSE2 is not available; skipped"
+		status=77
+	fi
+done
+cleanup
+exit $status
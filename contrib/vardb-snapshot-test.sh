@@ -0,0 +1,91 @@
+#!/bin/sh
+# Check that eix notices a file which is replaced in a package directory
+# of /var/db/pkg although the snapshot EIX_VARDB_SNAPSHOT has stored it.
+# Only changes of the package directory are noticed: a file which is
+# overwritten in place (e.g. with echo ... >USE) is not.
+# A small tree and an installed package are created in a temporary
+# directory; the eix and eix-update of ../src are used.
+#
+# This file is part of the eix project and distributed under the
+# terms of the GNU General Public License v2.
+#
+# Copyright (c)
+#   Martin Väth <martin@mvath.de>
+
+die() {
+	echo "!!! failed $*"
+	exit 1
+}
+
+src=${0%/*}/../src
+root=$(mktemp -d) || die mktemp
+
+cleanup() {
+	trap : INT HUP TERM
+	rm -rf -- "$root"
+	trap - INT HUP TERM
+}
+
+trap cleanup INT HUP TERM
+
+portdir=$root/usr/portage
+pkgdir=$root/var/db/pkg/app-test/foo-1
+mkdir -p "$portdir/profiles/default" "$portdir/app-test/foo" \
+	"$portdir/metadata/md5-cache/app-test" "$root/etc/portage" \
+	"$pkgdir" || die mkdir
+echo test >"$portdir/profiles/repo_name"
+echo app-test >"$portdir/profiles/categories"
+cat >"$portdir/profiles/default/make.defaults" <<'EOF'
+ARCH="amd64"
+ACCEPT_KEYWORDS="amd64"
+EOF
+echo 'EAPI=7' >"$portdir/app-test/foo/foo-1.ebuild"
+cat >"$portdir/metadata/md5-cache/app-test/foo-1" <<'EOF'
+DESCRIPTION=A test package
+EAPI=7
+IUSE=one two
+KEYWORDS=amd64
+SLOT=0
+EOF
+echo "PORTDIR=\"$portdir\"" >"$root/etc/portage/make.conf"
+ln -s "$portdir/profiles/default" "$root/etc/portage/make.profile"
+echo 0 >"$pkgdir/SLOT"
+echo 7 >"$pkgdir/EAPI"
+echo 'one two' >"$pkgdir/IUSE"
+echo one >"$pkgdir/USE"
+echo test >"$pkgdir/repository"
+
+EIXRC=$root/etc/eixrc
+EIX_CACHEFILE=$root/eix.cache
+EIX_VARDB_SNAPSHOT=$root/eix.vardb
+EIX_SETTINGS_SNAPSHOT=
+PORTAGE_CONFIGROOT=$root
+EPREFIX=$root
+EPREFIX_INSTALLED=$root
+ROOT=$root
+PORTDIR=$portdir
+EIX_USER=
+EIX_GROUP=
+EIX_UID=0
+EIX_GID=0
+REQUIRE_DROP=false
+NOCOLORS=true
+export EIXRC EIX_CACHEFILE EIX_VARDB_SNAPSHOT EIX_SETTINGS_SNAPSHOT \
+	PORTAGE_CONFIGROOT EPREFIX EPREFIX_INSTALLED ROOT PORTDIR \
+	EIX_USER EIX_GROUP EIX_UID EIX_GID REQUIRE_DROP NOCOLORS
+: >"$EIXRC"
+
+"$src"/eix-update -q || die eix-update
+
+# Directories changed in the current second are not stored
+sleep 1
+"$src"/eix -I --installed-without-use two -# >/dev/null || die "USE not read"
+test -s "$EIX_VARDB_SNAPSHOT" || die "snapshot not written"
+
+# sed -i replaces the file (like portage) and thus changes the directory
+sleep 1
+sed -i -e 's/^one$/one two/' "$pkgdir/USE" || die sed
+result=$("$src"/eix -I --installed-with-use two -#)
+cleanup
+[ x"$result" = x"app-test/foo" ] || die "replaced USE not noticed"
+echo "replaced USE noticed"
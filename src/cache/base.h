@@ -14,6 +14,7 @@
 
 #include <string>
 
+#include "eixTk/eixint.h"
 #include "eixTk/null.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/sysutils.h"
@@ -143,6 +144,16 @@ class BasicCache {
 			return readCategories(packagetree, NULLPTR, NULLPTR);
 		}
 
+		/**
+		If the categories can be read independently, an object which
+		reads them without sharing data with this one is returned, so that
+		readCategoryPrepare() etc. can be called for both in parallel.
+		@return NULLPTR if this is not possible
+		**/
+		virtual BasicCache *clone() const {
+			return NULLPTR;
+		}
+
 		/**
 		Prepare reading Cache for an individual category.
 		If not overloaded, then readCategories() must be overloaded.
@@ -166,6 +177,17 @@ class BasicCache {
 			return readCategories(NULLPTR, m_catname.c_str(), cat);
 		}
 
+		/**
+		Compute a fingerprint of the category defined before with
+		readCategoryPrepare() (independent of its return value) which
+		changes whenever readCategory() might read something different.
+		@return false if this is not supported
+		**/
+		virtual bool get_fingerprint(eix::UNumber *fingerprint ATTRIBUTE_UNUSED) const ATTRIBUTE_NONNULL_ {
+			UNUSED(fingerprint);
+			return false;
+		}
+
 		/**
 		This must be called to release the data stored with readCategoryPrepare().
 		After calling this, readCategory() must not be called without a new readCategoryPrepare().
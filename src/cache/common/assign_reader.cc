@@ -13,7 +13,6 @@
 #include <cstring>
 #include <ctime>
 
-#include <fstream>
 #include <string>
 
 #include "cache/base.h"
@@ -22,43 +21,71 @@
 #include "eixTk/i18n.h"
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
-#include "eixTk/stringtypes.h"
+#include "eixTk/stats.h"
 #include "eixTk/stringutils.h"
+#include "eixTk/utils.h"
 #include "portage/depend.h"
 #include "portage/package.h"
 #include "portage/version.h"
 
 using std::string;
 
-using std::ifstream;
+const char *const AssignReader::key_names[AssignReader::KEY_SIZE] = {
+	"_md5_",
+	"_mtime_",
+	"EAPI",
+	"KEYWORDS",
+	"SLOT",
+	"IUSE",
+	"REQUIRED_USE",
+	"RESTRICT",
+	"PROPERTIES",
+	"DEPEND",
+	"RDEPEND",
+	"PDEPEND",
+	"HDEPEND",
+	"HOMEPAGE",
+	"LICENSE",
+	"DESCRIPTION"
+};
 
 bool AssignReader::get_map(const char *file) {
-	if(currfile == NULLPTR) {
-		currfile = new string(file);
-		cf = new WordMap;
-	} else {
-		if(*currfile == file) {
-			return currstate;
-		}
-		currfile->assign(file);
-		cf->clear();
+	if(currfile == file) {
+		return currstate;
 	}
-
-	ifstream is(file);
-	if(unlikely(!is.is_open())) {
+	currfile.assign(file);
+	for(unsigned int k(0); likely(k != KEY_SIZE); ++k) {
+		values[k] = string::npos;
+	}
+	if(unlikely(!read_file_buffer(file, &buffer))) {
 		return (currstate = false);
 	}
+	Stats::count(Stats::CACHE_FILES);
 
-	while(likely(is.good())) {
-		string lbuf;
-		getline(is, lbuf);
-		string::size_type p(lbuf.find('='));
-		if(p == string::npos) {
-			continue;
+	string::size_type size(buffer.size());
+	for(string::size_type pos(0); likely(pos < size); ) {
+		string::size_type end(buffer.find('\n', pos));
+		if(end == string::npos) {
+			end = size;
+		} else {
+			buffer[end] = '\0';
+		}
+		const char *line(buffer.c_str() + pos);
+		const char *equal(static_cast<const char *>(memchr(line, '=', end - pos)));
+		if(equal != NULLPTR) {
+			string::size_type keylen(equal - line);
+			for(unsigned int k(0); likely(k != KEY_SIZE); ++k) {
+				const char *name(key_names[k]);
+				if((strncmp(name, line, keylen) == 0) && (name[keylen] == '\0')) {
+					// As in a map, the last occurrence wins
+					values[k] = pos + keylen + 1;
+					lengths[k] = end - values[k];
+					break;
+				}
+			}
 		}
-		(*cf)[lbuf.substr(0, p)].assign(lbuf, p + 1, string::npos);
+		pos = end + 1;
 	}
-	is.close();
 	return (currstate = true);
 }
 
@@ -66,22 +93,20 @@ const char *AssignReader::get_md5sum(const char *filename) {
 	if(unlikely(!get_map(filename))) {
 		return NULLPTR;
 	}
-	WordMap::const_iterator md5(cf->find("_md5_"));
-	if(md5 == cf->end()) {
+	if(values[KEY_MD5] == string::npos) {
 		return NULLPTR;
 	}
-	return md5->second.c_str();
+	return value(KEY_MD5);
 }
 
 bool AssignReader::get_mtime(time_t *t, const char *filename) {
 	if(unlikely(!get_map(filename))) {
 		return false;
 	}
-	WordMap::const_iterator mt(cf->find("_mtime_"));
-	if(mt == cf->end()) {
+	if(values[KEY_MTIME] == string::npos) {
 		return false;
 	}
-	return likely(((*t) = my_atois(mt->second.c_str())) != 0);
+	return likely(((*t) = my_atois(value(KEY_MTIME))) != 0);
 }
 
 /**
@@ -95,17 +120,21 @@ void AssignReader::get_keywords_slot_iuse_restrict(const string& filename, strin
 			% filename % strerror(errno));
 		return;
 	}
-	(*eapi)     = (*cf)["EAPI"];
-	(*keywords) = (*cf)["KEYWORDS"];
-	(*slotname) = (*cf)["SLOT"];
-	(*iuse)     = (*cf)["IUSE"];
-	(*restr)    = (*cf)["RESTRICT"];
-	(*props)    = (*cf)["PROPERTIES"];
+	assign(eapi, KEY_EAPI);
+	assign(keywords, KEY_KEYWORDS);
+	assign(slotname, KEY_SLOT);
+	assign(iuse, KEY_IUSE);
+	assign(restr, KEY_RESTRICT);
+	assign(props, KEY_PROPERTIES);
 	if(Version::use_required_use) {
-		(*required_use) = (*cf)["REQUIRED_USE"];
+		assign(required_use, KEY_REQUIRED_USE);
 	}
 	if(Depend::use_depend) {
-		dep->set((*cf)["DEPEND"], (*cf)["RDEPEND"], (*cf)["PDEPEND"], (*cf)["HDEPEND"], false);
+		assign(&(depend[0]), KEY_DEPEND);
+		assign(&(depend[1]), KEY_RDEPEND);
+		assign(&(depend[2]), KEY_PDEPEND);
+		assign(&(depend[3]), KEY_HDEPEND);
+		dep->set(depend[0], depend[1], depend[2], depend[3], false);
 	}
 }
 
@@ -118,7 +147,7 @@ void AssignReader::read_file(const char *filename, Package *pkg) {
 			% filename % strerror(errno));
 		return;
 	}
-	pkg->homepage = (*cf)["HOMEPAGE"];
-	pkg->licenses = (*cf)["LICENSE"];
-	pkg->desc     = (*cf)["DESCRIPTION"];
+	assign(&(pkg->homepage), KEY_HOMEPAGE);
+	assign(&(pkg->licenses), KEY_LICENSE);
+	assign(&(pkg->desc), KEY_DESCRIPTION);
 }
@@ -15,9 +15,6 @@
 #include <string>
 
 #include "cache/common/reader.h"
-#include "eixTk/likely.h"
-#include "eixTk/null.h"
-#include "eixTk/stringtypes.h"
 
 class BasicCache;
 class Depend;
@@ -26,14 +23,7 @@ class Package;
 class AssignReader : public BasicReader {
 	public:
 		explicit AssignReader(BasicCache *cache) :
-			BasicReader(cache), currfile(NULLPTR) {
-		}
-
-		~AssignReader() {
-			if(likely(currfile != NULLPTR)) {
-				delete currfile;
-				delete cf;
-			}
+			BasicReader(cache), currstate(false) {
 		}
 
 		const char *get_md5sum(const char *filename) ATTRIBUTE_NONNULL_;
@@ -42,11 +32,66 @@ class AssignReader : public BasicReader {
 		void read_file(const char *filename, Package *pkg) ATTRIBUTE_NONNULL_;
 
 	private:
+		/**
+		The keys which are extracted from the cache files
+		**/
+		enum Key {
+			KEY_MD5,
+			KEY_MTIME,
+			KEY_EAPI,
+			KEY_KEYWORDS,
+			KEY_SLOT,
+			KEY_IUSE,
+			KEY_REQUIRED_USE,
+			KEY_RESTRICT,
+			KEY_PROPERTIES,
+			KEY_DEPEND,
+			KEY_RDEPEND,
+			KEY_PDEPEND,
+			KEY_HDEPEND,
+			KEY_HOMEPAGE,
+			KEY_LICENSE,
+			KEY_DESCRIPTION,
+			KEY_SIZE
+		};
+
+		static const char *const key_names[KEY_SIZE];
+
+		/**
+		Read file into buffer and find the values of all keys in one pass.
+		The lines are terminated by '\0' in buffer, so that the values
+		can be used as C strings.
+		**/
 		bool get_map(const char *file) ATTRIBUTE_NONNULL_;
 
-		std::string *currfile;
-		WordMap *cf;
+		/**
+		@return the value of key (or an empty string) as a C string in buffer
+		**/
+		const char *value(Key key) const {
+			return ((values[key] == std::string::npos) ? "" : (buffer.c_str() + values[key]));
+		}
+
+		void assign(std::string *s, Key key) const ATTRIBUTE_NONNULL_ {
+			if(values[key] == std::string::npos) {
+				s->clear();
+			} else {
+				s->assign(buffer, values[key], lengths[key]);
+			}
+		}
+
+		std::string currfile, buffer;
 		bool currstate;
+
+		/**
+		Position and length of the value of each key in buffer
+		or std::string::npos if the key does not occur
+		**/
+		std::string::size_type values[KEY_SIZE], lengths[KEY_SIZE];
+
+		/**
+		Temporary strings for the dependencies whose capacity is reused
+		**/
+		std::string depend[4];
 };
 
 #endif  // SRC_CACHE_COMMON_ASSIGN_READER_H_
@@ -12,8 +12,6 @@
 #include <cerrno>
 #include <cstring>
 
-#include <fstream>
-#include <limits>
 #include <string>
 
 #include "cache/base.h"
@@ -22,100 +20,78 @@
 #include "eixTk/formated.h"
 #include "eixTk/i18n.h"
 #include "eixTk/likely.h"
+#include "eixTk/stats.h"
+#include "eixTk/utils.h"
 #include "portage/depend.h"
 #include "portage/package.h"
 #include "portage/version.h"
 
 using std::string;
 
-using std::ifstream;
-
-bool FlatReader::skip_lines(const eix::TinyUnsigned nr, ifstream *is, const string& filename) const {
-	for(eix::TinyUnsigned i(nr); likely(i != 0); --i) {
-		is->ignore(std::numeric_limits<int>::max(), '\n');
-		if(is->fail()) {
-			m_cache->m_error_callback(eix::format(_("cannot read cache file %s: %s"))
-				% filename % strerror(errno));
-			return false;
+bool FlatReader::get_lines(const char *file) {
+	if(currfile == file) {
+		return currstate;
+	}
+	currfile.assign(file);
+	count = 0;
+	if(unlikely(!read_file_buffer(file, &buffer))) {
+		m_cache->m_error_callback(eix::format(_("cannot open %s: %s"))
+			% file % strerror(errno));
+		return (currstate = false);
+	}
+	Stats::count(Stats::CACHE_FILES);
+	string::size_type size(buffer.size());
+	for(string::size_type pos(0); likely((pos < size) && (count != LINE_SIZE)); ++count) {
+		string::size_type end(buffer.find('\n', pos));
+		if(end == string::npos) {
+			end = size;
 		}
+		lines[count] = pos;
+		lengths[count] = end - pos;
+		pos = end + 1;
 	}
-	return true;
+	return (currstate = true);
 }
 
 /**
 Read the keywords and slot from a flat cache file
 **/
 void FlatReader::get_keywords_slot_iuse_restrict(const string& filename, string *eapi, string *keywords, string *slotname, string *iuse, string *required_use, string *restr, string *props, Depend *dep) {
-	ifstream is(filename.c_str());
-	if(!is.is_open()) {
-		m_cache->m_error_callback(eix::format(_("cannot open %s: %s"))
-			% filename % strerror(errno));
+	if(unlikely(!get_lines(filename.c_str()))) {
+		return;
 	}
-	string depend, rdepend, pdepend;
-	bool use_dep(Depend::use_depend);
-	if(use_dep) {
-		getline(is, depend);
-		getline(is, rdepend);
-	} else {
-		skip_lines(2, &is, filename);
+	assign(slotname, LINE_SLOT);
+	assign(restr, LINE_RESTRICT);
+	assign(keywords, LINE_KEYWORDS);
+	assign(iuse, LINE_IUSE);
+	if(Version::use_required_use) {
+		assign(required_use, LINE_REQUIRED_USE);
 	}
-	getline(is, *slotname);
-	skip_lines(1, &is, filename);
-	getline(is, *restr);
-	skip_lines(3, &is, filename);
-	getline(is, *keywords);
-	skip_lines(1, &is, filename);
-	getline(is, *iuse);
-	bool use_required_use(Version::use_required_use);
-	if(use_required_use) {
-		getline(is, *required_use);
+	assign(eapi, LINE_EAPI);
+	assign(props, LINE_PROPERTIES);
+	if(Depend::use_depend) {
+		// Older cache files need not contain HDEPEND
+		assign(&(depend[0]), LINE_DEPEND);
+		assign(&(depend[1]), LINE_RDEPEND);
+		assign(&(depend[2]), LINE_PDEPEND);
+		assign(&(depend[3]), LINE_HDEPEND);
+		dep->set(depend[0], depend[1], depend[2], depend[3], false);
 	}
-	if(use_dep) {
-		if(!use_required_use) {
-			skip_lines(1, &is, filename);
-		}
-		getline(is, pdepend);
-		skip_lines(1, &is, filename);
-	} else {
-		skip_lines((use_required_use ? 2 : 3), &is, filename);
-	}
-	getline(is, *eapi);
-	getline(is, *props);
-	if(use_dep) {
-		string hdepend;
-		skip_lines(1, &is, filename);
-		getline(is, hdepend);
-		dep->set(depend, rdepend, pdepend, hdepend, false);
+	if(unlikely(count <= LINE_PROPERTIES)) {
+		m_cache->m_error_callback(eix::format(_("cannot read cache file %s: %s"))
+			% filename % _("unexpected end of file"));
 	}
-	is.close();
 }
 
 /**
 Read a flat cache file
 **/
 void FlatReader::read_file(const char *filename, Package *pkg) {
-	ifstream is(filename);
-	if(!is.is_open()) {
-		m_cache->m_error_callback(eix::format(_("cannot open %s: %s"))
-			% filename % strerror(errno));
-	}
-	skip_lines(5, &is, filename);
-	string linebuf;
-	// Read the rest
-	for(eix::TinyUnsigned linenr(5); is.good(); ++linenr) {
-		getline(is, linebuf);
-		switch(linenr) {
-			case 5:  pkg->homepage = linebuf;
-			         break;
-			case 6:  pkg->licenses = linebuf;
-			         break;
-			case 7:  pkg->desc     = linebuf;
-			         is.close();
-			         return;
-			default:
-				break;
-		}
+	if(unlikely(!get_lines(filename))) {
+		return;
 	}
-	// We should never get here. However, we do not spit errors if we do...
-	is.close();
+	// We do not spit errors if lines are missing...
+	assign(&(pkg->homepage), LINE_HOMEPAGE);
+	assign(&(pkg->licenses), LINE_LICENSE);
+	assign(&(pkg->desc), LINE_DESCRIPTION);
 }
@@ -10,7 +10,6 @@
 #ifndef SRC_CACHE_COMMON_FLAT_READER_H_
 #define SRC_CACHE_COMMON_FLAT_READER_H_ 1
 
-#include <fstream>
 #include <string>
 
 #include "cache/common/reader.h"
@@ -22,14 +21,64 @@ class Package;
 
 class FlatReader : public BasicReader {
 	public:
-		explicit FlatReader(BasicCache *cache) : BasicReader(cache) {
+		explicit FlatReader(BasicCache *cache) : BasicReader(cache), currstate(false), count(0) {
 		}
 
 		void get_keywords_slot_iuse_restrict(const std::string& filename, std::string *eapi, std::string *keywords, std::string *slotname, std::string *iuse, std::string *required_use, std::string *restr, std::string *props, Depend *dep) ATTRIBUTE_NONNULL_;
 		void read_file(const char *filename, Package *pkg) ATTRIBUTE_NONNULL_;
 
 	private:
-		bool skip_lines(const eix::TinyUnsigned nr, std::ifstream *is, const std::string& filename) const ATTRIBUTE_NONNULL_;
+		/**
+		The lines of the cache files which are used
+		**/
+		enum Line {
+			LINE_DEPEND = 0,
+			LINE_RDEPEND = 1,
+			LINE_SLOT = 2,
+			LINE_RESTRICT = 4,
+			LINE_HOMEPAGE = 5,
+			LINE_LICENSE = 6,
+			LINE_DESCRIPTION = 7,
+			LINE_KEYWORDS = 8,
+			LINE_IUSE = 10,
+			LINE_REQUIRED_USE = 11,
+			LINE_PDEPEND = 12,
+			LINE_EAPI = 14,
+			LINE_PROPERTIES = 15,
+			LINE_HDEPEND = 17,
+			LINE_SIZE = 18
+		};
+
+		/**
+		Read file into buffer and find the first LINE_SIZE lines in one pass
+		@return false if the file cannot be read
+		**/
+		bool get_lines(const char *file) ATTRIBUTE_NONNULL_;
+
+		/**
+		Assign the line to s or clear s if the line does not exist
+		**/
+		void assign(std::string *s, Line line) const ATTRIBUTE_NONNULL_ {
+			if(line >= count) {
+				s->clear();
+			} else {
+				s->assign(buffer, lines[line], lengths[line]);
+			}
+		}
+
+		std::string currfile, buffer;
+		bool currstate;
+
+		/**
+		Number of lines found and their positions and lengths in buffer
+		**/
+		eix::TinyUnsigned count;
+		std::string::size_type lines[LINE_SIZE], lengths[LINE_SIZE];
+
+		/**
+		Temporary strings for the dependencies whose capacity is reused
+		**/
+		std::string depend[4];
 };
 
 #endif  // SRC_CACHE_COMMON_FLAT_READER_H_
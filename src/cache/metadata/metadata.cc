@@ -10,6 +10,7 @@
 #include <config.h>
 
 #include <dirent.h>
+#include <sys/stat.h>
 
 #include <cstdlib>
 #include <cstring>
@@ -21,6 +22,7 @@
 #include "cache/common/flat_reader.h"
 #include "cache/common/reader.h"
 #include "cache/metadata/metadata.h"
+#include "eixTk/eixint.h"
 #include "eixTk/formated.h"
 #include "eixTk/i18n.h"
 #include "eixTk/likely.h"
@@ -43,6 +45,8 @@ using std::string;
 #define PORTAGE_CACHE_PATH	"var/cache/edb/dep"
 
 static int cachefiles_selector(SCANDIR_ARG3 dent);
+static void hash_bytes(eix::UNumber *hash, const char *s, string::size_type len) ATTRIBUTE_NONNULL_;
+static void hash_stat(eix::UNumber *hash, const string& path) ATTRIBUTE_NONNULL_;
 
 bool MetadataCache::use_prefixport() const {
 	switch(path_type) {
@@ -150,6 +154,13 @@ void MetadataCache::setType(PathType set_path_type, bool set_flat) {
 	setFlat(set_flat);
 }
 
+BasicCache *MetadataCache::clone() const {
+	MetadataCache *c(new MetadataCache(*this));
+	c->reader = NULLPTR;
+	c->setFlat(flat);
+	return c;
+}
+
 void MetadataCache::setFlat(bool set_flat) {
 	delete reader;
 	if(set_flat) {
@@ -256,6 +267,51 @@ bool MetadataCache::readCategoryPrepare(const char *cat_name) {
 	return scandir_cc(m_catpath, &names, cachefiles_selector);
 }
 
+/**
+FNV-1a hash
+**/
+static void hash_bytes(eix::UNumber *hash, const char *s, string::size_type len) {
+	for(; likely(len != 0); --len) {
+		*hash ^= static_cast<eix::UChar>(*(s++));
+		*hash *= 16777619U;
+	}
+}
+
+/**
+Hash what changes if the file is replaced or modified
+**/
+static void hash_stat(eix::UNumber *hash, const string& path) {
+	struct stat st;
+	eix::UNumber data[3] = { 0, 0, 0 };
+	if(likely(stat(path.c_str(), &st) == 0)) {
+		data[0] = static_cast<eix::UNumber>(st.st_mtime);
+		data[1] = static_cast<eix::UNumber>(st.st_size);
+		data[2] = static_cast<eix::UNumber>(st.st_ino);
+	}
+	hash_bytes(hash, reinterpret_cast<const char *>(data), sizeof(data));
+}
+
+/**
+The _md5_ entries would require to read all files, hence
+we use the names, modification times, sizes, and inodes
+**/
+bool MetadataCache::get_fingerprint(eix::UNumber *fingerprint) const {
+	eix::UNumber hash(2166136261U);
+	hash_bytes(&hash, m_catpath.c_str(), m_catpath.size() + 1);
+	hash_bytes(&hash, (flat ? "f" : "a"), 1);
+	hash_stat(&hash, m_catpath);
+	string path(m_catpath);
+	path.append(1, '/');
+	string::size_type len(path.size());
+	for(WordVec::const_iterator it(names.begin()); likely(it != names.end()); ++it) {
+		hash_bytes(&hash, it->c_str(), it->size() + 1);
+		path.replace(len, string::npos, *it);
+		hash_stat(&hash, path);
+	}
+	*fingerprint = hash;
+	return true;
+}
+
 void MetadataCache::readCategoryFinalize() {
 	m_catname.clear();
 	m_catpath.clear();
@@ -298,8 +354,8 @@ bool MetadataCache::readCategory(Category *cat) {
 		string neweststring;
 
 		/* Split string into package and version, and catch any errors. */
-		char **aux(ExplodeAtom::split(it->c_str()));
-		if(unlikely(aux == NULLPTR)) {
+		char *aux[2];
+		if(unlikely(!ExplodeAtom::split(aux, it->c_str()))) {
 			m_error_callback(eix::format(_("cannot split \"%s\" into package and version")) % (*it));
 			++it;
 			continue;
@@ -344,8 +400,7 @@ bool MetadataCache::readCategory(Category *cat) {
 				break;
 
 			/* Split new filename into package and version, and catch any errors. */
-			aux = ExplodeAtom::split(it->c_str());
-			if(unlikely(aux == NULLPTR)) {
+			if(unlikely(!ExplodeAtom::split(aux, it->c_str()))) {
 				m_error_callback(eix::format(_("cannot split \"%s\" into package and version")) % (*it));
 				++it;
 				break;
@@ -16,6 +16,7 @@
 
 #include "cache/base.h"
 #include "cache/common/reader.h"
+#include "eixTk/eixint.h"
 #include "eixTk/null.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/sysutils.h"
@@ -56,9 +57,12 @@ class MetadataCache : public BasicCache {
 
 		bool initialize(const std::string& name);
 
+		BasicCache *clone() const;
+
 		bool readCategoryPrepare(const char *cat_name) ATTRIBUTE_NONNULL_;
 		bool readCategory(Category *cat) ATTRIBUTE_NONNULL_;
 		void readCategoryFinalize();
+		bool get_fingerprint(eix::UNumber *fingerprint) const ATTRIBUTE_NONNULL_;
 
 		const char *get_md5sum(const char *pkg_name, const char *ver_name) const ATTRIBUTE_NONNULL_;
 		bool get_time(time_t *t, const char *pkg_name, const char *ver_name) const ATTRIBUTE_NONNULL_;
@@ -25,6 +25,7 @@
 #include "eixTk/likely.h"
 #include "eixTk/md5.h"
 #include "eixTk/null.h"
+#include "eixTk/stats.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/stringutils.h"
 #include "eixTk/sysutils.h"
@@ -204,6 +205,7 @@ void ParseCache::parse_exec(const char *fullpath, const string& dirpath, bool re
 			ebuild.useMap(&env);
 		}
 		string errtext;
+		Stats::count(Stats::CACHE_FILES);
 		if(!ebuild.read(fullpath, &errtext, false)) {
 			m_error_callback(eix::format(_("cannot properly parse %s: %s")) % fullpath % errtext);
 		}
@@ -25,7 +25,10 @@ using std::string;
 const DBHeader::SaveBitmask
 	DBHeader::SAVE_BITMASK_NONE,
 	DBHeader::SAVE_BITMASK_DEP,
-	DBHeader::SAVE_BITMASK_REQUIRED_USE;
+	DBHeader::SAVE_BITMASK_REQUIRED_USE,
+	DBHeader::SAVE_BITMASK_TRIGRAMS,
+	DBHeader::SAVE_BITMASK_COLUMNS,
+	DBHeader::SAVE_BITMASK_RDEPENDS;
 
 const DBHeader::OverlayTest
 	DBHeader::OVTEST_NONE,
@@ -43,7 +46,7 @@ const DBHeader::DBVersion DBHeader::current;
 Which version we do accept. The list must end with 0
 **/
 const DBHeader::DBVersion DBHeader::accept[] = {
-	DBHeader::current, 35, 34, 33, 32, 31,
+	DBHeader::current, 36, 35, 34, 33, 32, 31,
 	0
 };
 
@@ -12,6 +12,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "eixTk/constexpr.h"
 #include "eixTk/eixint.h"
@@ -47,12 +48,24 @@ class DBHeader {
 		static CONSTEXPR SaveBitmask
 			SAVE_BITMASK_NONE         = 0x00U,
 			SAVE_BITMASK_DEP          = 0x01U,
-			SAVE_BITMASK_REQUIRED_USE = 0x02U;
+			SAVE_BITMASK_REQUIRED_USE = 0x02U,
+			SAVE_BITMASK_TRIGRAMS     = 0x04U,
+			SAVE_BITMASK_COLUMNS      = 0x08U,
+			SAVE_BITMASK_RDEPENDS     = 0x10U;
 
-		bool use_depend, use_required_use;
+		bool use_depend, use_required_use, use_trigrams, use_columns, use_rdepends;
 
 		WordVec world_sets;
 
+		/**
+		For each overlay the cache method and the fingerprints of all
+		categories (in the order of the package tree). The method is empty
+		if the cache cannot compute fingerprints.
+		eix-update uses this to reuse unchanged categories.
+		**/
+		WordVec fingerprint_methods;
+		std::vector<std::vector<eix::UNumber> > fingerprints;
+
 		typedef  eix::UNumber DBVersion;
 
 		typedef  eix::UChar OverlayTest;
@@ -71,7 +84,7 @@ class DBHeader {
 		/**
 		Current version of database-format and what we accept
 		**/
-		static CONSTEXPR DBVersion current = 36;
+		static CONSTEXPR DBVersion current = 37;
 		static const DBVersion accept[];
 
 		/**
@@ -82,6 +95,10 @@ class DBHeader {
 		Number of categories
 		**/
 		eix::Catsize size;
+		/**
+		Position of the package index in the file or 0 if there is none
+		**/
+		eix::OffsetType index_offset;
 
 		/**
 		Get overlay for key from table
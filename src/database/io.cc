@@ -7,26 +7,36 @@
 
 #include <config.h>
 
+#include <sys/stat.h>
+#include <sys/types.h>
+
 #include <cstdio>
+#include <cstring>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #ifdef HAVE_SYS_FILE_H
 #include <sys/file.h>
 #endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
 
 #include "database/header.h"
 #include "database/io.h"
-#include "eixTk/auto_list.h"
 #include "eixTk/diagnostics.h"
 #include "eixTk/eixint.h"
 #include "eixTk/i18n.h"
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
+#include "eixTk/stats.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/stringutils.h"
 
 using std::string;
+using std::vector;
 
 bool File::openread(const char *name) {
 	if((fp = fopen(name, "rb")) == NULLPTR) {
@@ -37,9 +47,42 @@ bool File::openread(const char *name) {
 	flock(fileno(fp), LOCK_SH);
 #endif
 #endif
+	map_file();
+	if(unlikely(Stats::enabled)) {
+		read_mark = tell();
+	}
 	return true;
 }
 
+/**
+Map the file opened for reading (if possible).
+On failure, we silently fall back to stdio.
+**/
+void File::map_file() {
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_FILENO)
+	int fd(fileno(fp));
+	struct stat st;
+	if(unlikely((fstat(fd, &st) != 0) || (st.st_size <= 0))) {
+		return;
+	}
+	void *p(mmap(NULLPTR, st.st_size, PROT_READ, MAP_SHARED, fd, 0));
+	if(unlikely(p == MAP_FAILED)) {
+		return;
+	}
+	map_current = map_begin = static_cast<const char *>(p);
+	map_end = map_begin + st.st_size;
+#endif
+}
+
+void File::unmap_file() {
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_FILENO)
+	if(map_begin != NULLPTR) {
+		munmap(const_cast<char *>(map_begin), map_end - map_begin);
+	}
+#endif
+	map_begin = map_end = map_current = NULLPTR;
+}
+
 bool File::openwrite(const char *name) {
 	if((fp = fopen(name, "wb")) == NULLPTR) {
 		return false;
@@ -56,6 +99,10 @@ File::~File() {
 	if(unlikely(fp == NULLPTR)) {
 		return;
 	}
+	wbuf_hold = 0;
+	flush_buffer();
+	count_read();
+	unmap_file();
 #ifdef HAVE_FILENO
 #ifdef HAVE_FLOCK
 	// do not unlock: fclose(fp) will unlock anyway, and maybe some
@@ -66,13 +113,75 @@ File::~File() {
 	fclose(fp);
 }
 
+bool File::flush_buffer() {
+	if((wbuf_hold != 0) || wbuf.empty()) {
+		return true;
+	}
+	bool ok(fwrite(static_cast<const void *>(wbuf.data()), sizeof(*(wbuf.data())), wbuf.size(), fp) == wbuf.size());
+	wbuf.clear();
+	return ok;
+}
+
+bool File::flush(string *errtext) {
+	if(likely(flush_buffer())) {
+		return true;
+	}
+	writeError(errtext);
+	return false;
+}
+
+bool File::release_buffer(string::size_type start, string::size_type middle, string *errtext) {
+	std::rotate(wbuf.begin() + start, wbuf.begin() + middle, wbuf.end());
+	if((--wbuf_hold != 0) || likely(wbuf.size() < WRITE_BUFFER_SIZE)) {
+		return true;
+	}
+	return flush(errtext);
+}
+
+/**
+Account the bytes read sequentially since the last seek
+**/
+void File::count_read() {
+	if(likely(read_mark < 0)) {
+		return;
+	}
+	eix::OffsetType pos(tell());
+	if(pos > read_mark) {
+		Stats::count(Stats::BYTES_READ, pos - read_mark);
+	}
+	read_mark = pos;
+}
+
 bool File::seek(eix::OffsetType offset, int whence, string *errtext) {
+	if(unlikely(!flush(errtext))) {
+		return false;
+	}
+	count_read();
+	if(whence == SEEK_SET) {
+		Stats::count(Stats::SEEKS);
+	}
+	if(likely(map_begin != NULLPTR)) {
+		const char *base((whence == SEEK_SET) ? map_begin : map_current);
+		if(likely((offset >= map_begin - base) && (offset <= map_end - base))) {
+			map_current = base + offset;
+			if(unlikely(read_mark >= 0)) {
+				read_mark = tell();
+			}
+			return true;
+		}
+	} else {
 #ifdef HAVE_FSEEKO
-	if(likely(fseeko(fp, offset, whence) == 0))
+		bool ok(fseeko(fp, offset, whence) == 0);
 #else
-	if(likely(fseek(fp, offset, whence) == 0))
+		bool ok(fseek(fp, offset, whence) == 0);
 #endif
-		return true;
+		if(likely(ok)) {
+			if(unlikely(read_mark >= 0)) {
+				read_mark = tell();
+			}
+			return true;
+		}
+	}
 	if(errtext != NULLPTR) {
 		*errtext = _("fseek failed");
 	}
@@ -80,15 +189,53 @@ bool File::seek(eix::OffsetType offset, int whence, string *errtext) {
 }
 
 eix::OffsetType File::tell() {
+	if(likely(map_begin != NULLPTR)) {
+		return (map_current - map_begin);
+	}
 #ifdef HAVE_FSEEKO
 	// We rely on autoconf whose documentation states:
 	// All systems with fseeko() also supply ftello()
-	return ftello(fp);
+	return ftello(fp) + eix::OffsetType(wbuf.size());
 #else
-	return ftell(fp);
+	return ftell(fp) + eix::OffsetType(wbuf.size());
 #endif
 }
 
+bool File::read(char *s, string::size_type len) {
+	if(likely(map_begin != NULLPTR)) {
+GCC_DIAG_OFF(sign-conversion)
+		if(unlikely(len > string::size_type(map_end - map_current))) {
+GCC_DIAG_ON(sign-conversion)
+			map_current = map_end;
+			return false;
+		}
+		std::memcpy(s, map_current, len);
+		map_current += len;
+		return true;
+	}
+	return (fread(s, sizeof(*s), len, fp) == len);
+}
+
+bool File::read_string_plain(string *s, string::size_type len, string *errtext) {
+	if(likely(map_begin != NULLPTR)) {
+GCC_DIAG_OFF(sign-conversion)
+		if(likely(len <= string::size_type(map_end - map_current))) {
+GCC_DIAG_ON(sign-conversion)
+			s->assign(map_current, len);
+			map_current += len;
+			return true;
+		}
+		map_current = map_end;
+	} else {
+		s->resize(len);
+		if(likely((len == 0) || read(&((*s)[0]), len))) {
+			return true;
+		}
+	}
+	readError(errtext);
+	return false;
+}
+
 bool File::read_string_plain(char *s, string::size_type len, string *errtext) {
 	if(likely(read(s, len))) {
 		return true;
@@ -107,7 +254,8 @@ bool File::write_string_plain(const string& str, string *errtext) {
 
 void File::readError(string *errtext) {
 	if(errtext != NULLPTR) {
-		*errtext = (feof(fp) ?
+		bool at_eof((map_begin != NULLPTR) ? (map_current == map_end) : (feof(fp) != 0));
+		*errtext = (at_eof ?
 			_("error while reading from database: end of file") :
 			_("error while reading from database"));
 	}
@@ -130,23 +278,11 @@ bool Database::readUChar(eix::UChar *c, string *errtext) {
 }
 
 bool Database::writeUChar(eix::UChar c, string *errtext) {
-	if(counting) {
-		++counter;
-	} else if(unlikely(!putch(c))) {
-		writeError(errtext);
-		return false;
-	}
-	return true;
-}
-
-bool Database::write_string_plain(const string& str, string *errtext) {
-	if(counting) {
-GCC_DIAG_OFF(sign-conversion)
-		counter += str.size();
-GCC_DIAG_ON(sign-conversion)
+	if(likely(putch(c))) {
 		return true;
 	}
-	return File::write_string_plain(str, errtext);
+	writeError(errtext);
+	return false;
 }
 
 bool Database::read_string(string *s, string *errtext) {
@@ -154,13 +290,7 @@ bool Database::read_string(string *s, string *errtext) {
 	if(unlikely(!read_num(&len, errtext))) {
 		return false;
 	}
-	eix::auto_list<char> buf(new char[len + 1]);
-	buf.get()[len] = 0;
-	if(likely(read_string_plain(buf.get(), len, errtext))) {
-		*s = buf.get();
-		return true;
-	}
-	return false;
+	return read_string_plain(s, len, errtext);
 }
 
 bool Database::write_string(const string& str, string *errtext) {
@@ -168,6 +298,12 @@ bool Database::write_string(const string& str, string *errtext) {
 		likely(write_string_plain(str, errtext)));
 }
 
+bool Database::end_length(string::size_type start, string *errtext) {
+	string::size_type middle(buffered());
+	return (likely(write_num(middle - start, errtext)) &&
+		likely(release_buffer(start, middle, errtext)));
+}
+
 bool Database::write_hash_words(const StringHash& hash, const WordVec& words, string *errtext) {
 	if(unlikely(!write_num(words.size(), errtext))) {
 		return false;
@@ -194,17 +330,25 @@ bool Database::read_hash_words(const StringHash& hash, WordVec *s, string *errte
 	return true;
 }
 
-bool Database::read_hash_words(const StringHash& hash, string *s, string *errtext) {
+bool Database::read_hash_words(const StringHash& hash, string *s, vector<StringHash::size_type> *ids, string *errtext) {
 	s->clear();
+	if(ids != NULLPTR) {
+		ids->clear();
+	}
 	WordVec::size_type e;
 	if(unlikely(!read_num(&e, errtext))) {
 		return false;
 	}
 	for(; e != 0; --e) {
-		string r;
-		if(unlikely(!read_hash_string(hash, &r, errtext))) {
+		StringHash::size_type i;
+		if(unlikely(!read_num(&i, errtext))) {
 			return false;
 		}
+		if(ids != NULLPTR) {
+			ids->push_back(i);
+		}
+		string r;
+		hash.get(&r, i);
 		if(!s->empty()) {
 			s->append(1, ' ');
 		}
@@ -10,8 +10,11 @@
 
 #include <cstdio>
 
+#include <map>
 #include <string>
+#include <vector>
 
+#include "database/package_index.h"
 #include "eixTk/diagnostics.h"
 #include "eixTk/eixint.h"
 #include "eixTk/likely.h"
@@ -33,13 +36,62 @@ class Version;
 
 #define MAGICNUMCHAR 0xFFU
 
+/**
+Width of the fixed-length numbers in the package index:
+file offsets, package numbers, and trigrams, respectively
+**/
+#define OFFSET_BYTES 8U
+#define INDEX_BYTES 4U
+#define TRIGRAM_BYTES 3U
+
+/**
+Width of the offsets of the entries of a hash
+**/
+#define HASH_OFFSET_BYTES 4U
+
+/**
+Width of the fingerprints of categories
+**/
+#define FINGERPRINT_BYTES 8U
+
+/**
+Size from which on the collected data is written to the database file
+**/
+#define WRITE_BUFFER_SIZE 0x40000U
+
 class File {
 	private:
 		FILE *fp;
+
+		/**
+		If the file is opened for reading and mmap is available,
+		the whole file is mapped, and reading is only moving a cursor.
+		Otherwise map_begin is NULLPTR and stdio is used.
+		**/
+		const char *map_begin, *map_end, *map_current;
+
+		/**
+		Data to be written is collected in wbuf and written in large blocks.
+		While wbuf_hold is nonzero, nothing is written so that data can
+		still be inserted into wbuf.
+		**/
+		std::string wbuf;
+		unsigned int wbuf_hold;
+
+		/**
+		If statistics are enabled for a file opened for reading, the
+		position from which on the file was read sequentially; else -1
+		**/
+		eix::OffsetType read_mark;
+
+		bool flush_buffer();
+		void count_read();
 		bool seek(eix::OffsetType offset, int whence, std::string *errtext);
+		void map_file();
+		void unmap_file();
 
 	public:
-		File() : fp(NULLPTR) {
+		File() : fp(NULLPTR), map_begin(NULLPTR), map_end(NULLPTR), map_current(NULLPTR), wbuf_hold(0), read_mark(-1) {
 		}
 
 		~File();
@@ -48,22 +100,58 @@ class File {
 		bool openwrite(const char *name) ATTRIBUTE_NONNULL_;
 
 		int getch() {
+			if(likely(map_begin != NULLPTR)) {
+				if(likely(map_current != map_end)) {
+					return static_cast<eix::UChar>(*(map_current++));
+				}
+				return EOF;
+			}
 			return fgetc(fp);
 		}
 
 		bool putch(eix::UChar c) {
-			return (fputc(c, fp) != EOF);
+			wbuf.append(1, static_cast<char>(c));
+			return (likely(wbuf.size() < WRITE_BUFFER_SIZE) || flush_buffer());
 		}
 
-		bool read(char *s, std::string::size_type len) {
-			return (fread(s, sizeof(*s), len, fp) == len);
+		bool read(char *s, std::string::size_type len);
+
+		bool write(const std::string& str) {
+			wbuf.append(str);
+			return (likely(wbuf.size() < WRITE_BUFFER_SIZE) || flush_buffer());
 		}
 
-		bool write(const std::string str) {
-			return (fwrite(static_cast<const void *>(str.c_str()), sizeof(*(str.c_str())), str.size(), fp) == str.size());
+		/**
+		Write all collected data to the file
+		**/
+		bool flush(std::string *errtext);
+
+		/**
+		Keep all subsequently written data in the buffer until the
+		corresponding release_buffer()
+		@return the position of the subsequently written data in the buffer
+		**/
+		std::string::size_type hold_buffer() {
+			++wbuf_hold;
+			return wbuf.size();
 		}
 
+		std::string::size_type buffered() const {
+			return wbuf.size();
+		}
+
+		/**
+		Move the data written into the buffer from position middle on
+		in front of the data from position start on and undo hold_buffer()
+		**/
+		bool release_buffer(std::string::size_type start, std::string::size_type middle, std::string *errtext);
+
 		bool read_string_plain(char *s, std::string::size_type len, std::string *errtext) ATTRIBUTE_NONNULL((2));
+		/**
+		Assign the next len bytes to s; with a mapped file this is
+		a single copy from the mapping without intermediate buffers
+		**/
+		bool read_string_plain(std::string *s, std::string::size_type len, std::string *errtext) ATTRIBUTE_NONNULL((2));
 		bool write_string_plain(const std::string& str, std::string *errtext);
 
 		bool seekrel(eix::OffsetType offset, std::string *errtext) {
@@ -76,20 +164,37 @@ class File {
 
 		eix::OffsetType tell();
 
+		/**
+		@return the address of the len bytes at offset if the file is mapped,
+		NULLPTR otherwise. The memory remains valid while the file is open.
+		**/
+		const char *mapped(eix::OffsetType offset, eix::OffsetType len) const {
+			if(map_begin == NULLPTR) {
+				return NULLPTR;
+			}
+			eix::OffsetType size(map_end - map_begin);
+			if(unlikely((offset < 0) || (len < 0) || (offset > size) || (len > size - offset))) {
+				return NULLPTR;
+			}
+			return map_begin + offset;
+		}
+
 		void readError(std::string *errtext);
 		static void writeError(std::string *errtext);
 };
 
 class Database : public File {
+		friend class PackageIndex;
 		friend class PackageReader;
 
 	private:
-		bool counting;
-		eix::OffsetType counter;
+		/**
+		Where write_header() left room for the offset of the package index
+		**/
+		eix::OffsetType index_patch;
 
 		bool read_Part(BasicPart *b, std::string *errtext) ATTRIBUTE_NONNULL((2));
 		bool write_Part(const BasicPart& n, std::string *errtext);
-		bool write_string_plain(const std::string& str, std::string *errtext);
 
 	protected:
 		bool readUChar(eix::UChar *c, std::string *errtext);
@@ -105,9 +210,34 @@ class Database : public File {
 		**/
 		template<typename m_Tp> bool write_num(m_Tp t, std::string *errtext);
 
+		/**
+		Read a nonnegative number stored in exactly len bytes (big endian).
+		In contrast to read_num(), such numbers can be accessed by index
+		and overwritten later on.
+		**/
+		template<typename m_Tp> bool read_fixed(m_Tp *ret, unsigned int len, std::string *errtext) ATTRIBUTE_NONNULL((2));
+
+		/**
+		Write nonnegative number t in exactly len bytes (big endian)
+		**/
+		template<typename m_Tp> bool write_fixed(m_Tp t, unsigned int len, std::string *errtext);
+
 		bool read_string(std::string *s, std::string *errtext) ATTRIBUTE_NONNULL((2));
 		bool write_string(const std::string& str, std::string *errtext);
 
+		/**
+		Start data which is to be preceded by its length
+		@return the argument for end_length()
+		**/
+		std::string::size_type begin_length() {
+			return hold_buffer();
+		}
+
+		/**
+		Insert the length of the data written since begin_length() in front of it
+		**/
+		bool end_length(std::string::size_type start, std::string *errtext);
+
 		bool write_hash_string(const StringHash& hash, const std::string& s, std::string *errtext) {
 			return write_num(hash.get_index(s), errtext);
 		}
@@ -115,7 +245,7 @@ class Database : public File {
 		bool read_hash_string(const StringHash& hash, std::string *s, std::string *errtext) ATTRIBUTE_NONNULL((3)) {
 			StringHash::size_type i;
 			if(likely(read_num(&i, errtext))) {
-				*s = hash[i];
+				hash.get(s, i);
 				return true;
 			}
 			return false;
@@ -128,7 +258,15 @@ class Database : public File {
 		}
 
 		bool read_hash_words(const StringHash& hash, WordVec *s, std::string *errtext) ATTRIBUTE_NONNULL((3));
-		bool read_hash_words(const StringHash& hash, std::string *s, std::string *errtext) ATTRIBUTE_NONNULL((3));
+		bool read_hash_words(const StringHash& hash, std::string *s, std::string *errtext) ATTRIBUTE_NONNULL((3)) {
+			return read_hash_words(hash, s, NULLPTR, errtext);
+		}
+
+		/**
+		Read words joined by spaces; if ids is not NULLPTR,
+		also store their indices in hash
+		**/
+		bool read_hash_words(const StringHash& hash, std::string *s, std::vector<StringHash::size_type> *ids, std::string *errtext) ATTRIBUTE_NONNULL((3));
 		bool read_hash_words(std::string *errtext);
 
 		bool read_iuse(const StringHash& hash, IUseSet *iuse, std::string *errtext) ATTRIBUTE_NONNULL((3));
@@ -144,12 +282,25 @@ class Database : public File {
 
 		bool write_package(const Package& pkg, const DBHeader& hdr, std::string *errtext);
 		bool write_package_pure(const Package& pkg, const DBHeader& hdr, std::string *errtext);
+		bool write_column(const Package& pkg, PackageIndex::Column column, const DBHeader& hdr, std::string *errtext);
+		bool write_columns(const PackageTree& tree, const DBHeader& hdr, std::vector<eix::OffsetType> *offsets, std::string *errtext) ATTRIBUTE_NONNULL((4));
+
+		bool write_package_index(const PackageTree& tree, const DBHeader& hdr, const std::vector<eix::OffsetType>& offsets, std::string *errtext);
+		bool write_postings(const std::vector<std::vector<eix::Treesize> >& postings, std::string *errtext);
+		bool write_rdepends(const std::map<std::string, PackageIndex::RDepends>& rdepends, std::string *errtext);
+
+		/**
+		Write offsets into the table reserved at position table
+		and continue behind the last offset
+		**/
+		bool patch_offsets(eix::OffsetType table, const std::vector<eix::OffsetType>& offsets, std::string *errtext);
+		bool write_fingerprints(const PackageTree& tree, const DBHeader& hdr, std::string *errtext);
 
 		bool write_hash(const StringHash& hash, std::string *errtext);
-		bool read_hash(StringHash *hash, std::string *errtext) ATTRIBUTE_NONNULL((2));
+		bool read_hash(StringHash *hash, const DBHeader& hdr, std::string *errtext) ATTRIBUTE_NONNULL((2));
 
 	public:
-		Database() : counting(false), counter(0) {
+		Database() : index_patch(0) {
 		}
 
 		static void prep_header_hashs(DBHeader *hdr, const PackageTree& tree) ATTRIBUTE_NONNULL_;
@@ -161,6 +312,20 @@ class Database : public File {
 		bool read_packagetree(PackageTree *tree, const DBHeader& hdr, PortageSettings *ps, std::string *errtext) ATTRIBUTE_NONNULL((2, 4));
 };
 
+/**
+Reading and writing of numbers and strings in the format of the
+eix database for the snapshot files which are stored beside it
+**/
+class SnapshotFile : public Database {
+	public:
+		using Database::read_num;
+		using Database::write_num;
+		using Database::read_string;
+		using Database::write_string;
+		using Database::begin_length;
+		using Database::end_length;
+};
+
 template<typename m_Tp> bool Database::read_num(m_Tp *ret, std::string *errtext) {
 	int ch(getch());
 	if(likely(ch != EOF)) {
@@ -206,14 +371,6 @@ GCC_DIAG_OFF(sign-conversion)
 GCC_DIAG_ON(sign-conversion)
 	// Test the most common case explicitly to speed up:
 	if(t == static_cast<m_Tp>(c)) {
-		if(counting) {
-			if(unlikely(c == MAGICNUMCHAR)) {
-				counter += 2;
-			} else {
-				++counter;
-			}
-			return true;
-		}
 		if(likely(putch(c))) {
 			if(likely(c != MAGICNUMCHAR)) {
 				return true;
@@ -234,13 +391,6 @@ GCC_DIAG_ON(sign-conversion)
 			++count;
 		} while((t & mask) != t);
 		// We have count > 0 here
-		if(counting) {
-GCC_DIAG_OFF(sign-conversion)
-			eix::UChar d((t >> (8*count)) & 0xFFU);
-			counter += ((unlikely(d == MAGICNUMCHAR)) ? 2 : 1) + (2 * count);
-GCC_DIAG_ON(sign-conversion)
-			return true;
-		}
 		for(unsigned int r(count); ;) {
 			if(unlikely(!putch(MAGICNUMCHAR))) {
 				break;
@@ -279,4 +429,32 @@ GCC_DIAG_ON(sign-conversion)
 	return false;
 }
 
+template<typename m_Tp> bool Database::read_fixed(m_Tp *ret, unsigned int len, std::string *errtext) {
+	*ret = 0;
+	for(; likely(len != 0); --len) {
+		int ch(getch());
+		if(unlikely(ch == EOF)) {
+			readError(errtext);
+			return false;
+		}
+		*ret = ((*ret) << 8) |
+			static_cast<m_Tp>(static_cast<eix::UChar>(ch));
+	}
+	return true;
+}
+
+template<typename m_Tp> bool Database::write_fixed(m_Tp t, unsigned int len, std::string *errtext) {
+	while(likely(len-- != 0)) {
+		// shifting by the full width of m_Tp would be undefined:
+GCC_DIAG_OFF(sign-conversion)
+		eix::UChar c((len < sizeof(m_Tp)) ? ((t >> (8*len)) & 0xFFU) : 0);
+GCC_DIAG_ON(sign-conversion)
+		if(unlikely(!putch(c))) {
+			writeError(errtext);
+			return false;
+		}
+	}
+	return true;
+}
+
 #endif  // SRC_DATABASE_IO_H_
@@ -60,6 +60,13 @@ GCC_DIAG_ON(sign-conversion)
 		return false;
 	}
 
+	hdr->index_offset = 0;
+	if(likely(hdr->version >= 37)) {
+		if(unlikely(!read_fixed(&(hdr->index_offset), OFFSET_BYTES, errtext))) {
+			return false;
+		}
+	}
+
 	ExtendedVersion::Overlay overlay_sz;
 	if(unlikely(!read_num(&(overlay_sz), errtext))) {
 		return false;
@@ -77,20 +84,20 @@ GCC_DIAG_ON(sign-conversion)
 	}
 
 	if(likely(hdr->version >= 36)) {
-		if(unlikely(!read_hash(&(hdr->eapi_hash), errtext))) {
+		if(unlikely(!read_hash(&(hdr->eapi_hash), *hdr, errtext))) {
 			return false;
 		}
 	}
-	if(unlikely(!read_hash(&(hdr->license_hash), errtext))) {
+	if(unlikely(!read_hash(&(hdr->license_hash), *hdr, errtext))) {
 		return false;
 	}
-	if(unlikely(!read_hash(&(hdr->keywords_hash), errtext))) {
+	if(unlikely(!read_hash(&(hdr->keywords_hash), *hdr, errtext))) {
 		return false;
 	}
-	if(unlikely(!read_hash(&(hdr->iuse_hash), errtext))) {
+	if(unlikely(!read_hash(&(hdr->iuse_hash), *hdr, errtext))) {
 		return false;
 	}
-	if(unlikely(!read_hash(&(hdr->slot_hash), errtext))) {
+	if(unlikely(!read_hash(&(hdr->slot_hash), *hdr, errtext))) {
 		return false;
 	}
 
@@ -111,13 +118,16 @@ GCC_DIAG_ON(sign-conversion)
 		return false;
 	}
 	hdr->use_required_use = ((save_bitmask & DBHeader::SAVE_BITMASK_REQUIRED_USE) != 0);
+	hdr->use_trigrams = ((save_bitmask & DBHeader::SAVE_BITMASK_TRIGRAMS) != 0);
+	hdr->use_columns = ((save_bitmask & DBHeader::SAVE_BITMASK_COLUMNS) != 0);
+	hdr->use_rdepends = ((save_bitmask & DBHeader::SAVE_BITMASK_RDEPENDS) != 0);
 	if((hdr->use_depend = ((save_bitmask & DBHeader::SAVE_BITMASK_DEP) != 0))) {
 		eix::OffsetType len;
 		if(unlikely(!read_num(&len, errtext))) {
 			return false;
 		}
 		if(Depend::use_depend) {
-			if(unlikely(!read_hash(&(hdr->depend_hash), errtext))) {
+			if(unlikely(!read_hash(&(hdr->depend_hash), *hdr, errtext))) {
 				return false;
 			}
 		} else if(len != 0) {
@@ -129,15 +139,56 @@ GCC_DIAG_ON(sign-conversion)
 	return true;
 }
 
-bool Database::read_hash(StringHash *hash, string *errtext) {
+/**
+Since version 37, the strings are preceded by a table of their offsets.
+If the file is mapped, the entries are then only resolved on demand.
+**/
+bool Database::read_hash(StringHash *hash, const DBHeader& hdr, string *errtext) {
 	hash->init(false);
 	StringHash::size_type i;
 	if(unlikely(!read_num(&i, errtext))) {
 		return false;
 	}
-	for(; likely(i != 0); --i) {
+	if(hdr.version < 37) {
+		for(; likely(i != 0); --i) {
+			string s;
+			if(unlikely(!read_string(&s, errtext))) {
+				return false;
+			}
+			hash->store_string(s);
+		}
+		hash->finalize();
+		return true;
+	}
+	eix::OffsetType table(tell());
+	eix::OffsetType data(table + static_cast<eix::OffsetType>((i + 1) * HASH_OFFSET_BYTES));
+	eix::OffsetType len;
+	if(unlikely(!(seekabs(data - HASH_OFFSET_BYTES, errtext) &&
+		read_fixed(&len, HASH_OFFSET_BYTES, errtext)))) {
+		return false;
+	}
+	const char *table_mem(mapped(table, data - table));
+	const char *data_mem(mapped(data, len));
+	if(likely((table_mem != NULLPTR) && (data_mem != NULLPTR))) {
+		hash->init_lazy(table_mem, HASH_OFFSET_BYTES, data_mem, i);
+		return seekabs(data + len, errtext);
+	}
+	vector<string::size_type> offsets(i + 1);
+	if(unlikely(!seekabs(table, errtext))) {
+		return false;
+	}
+	for(StringHash::size_type j(0); likely(j <= i); ++j) {
+		if(unlikely(!read_fixed(&(offsets[j]), HASH_OFFSET_BYTES, errtext))) {
+			return false;
+		}
+	}
+	for(StringHash::size_type j(0); likely(j != i); ++j) {
+		if(unlikely(offsets[j + 1] < offsets[j])) {
+			readError(errtext);
+			return false;
+		}
 		string s;
-		if(unlikely(!read_string(&s, errtext))) {
+		if(unlikely(!read_string_plain(&s, offsets[j + 1] - offsets[j], errtext))) {
 			return false;
 		}
 		hash->store_string(s);
@@ -7,12 +7,16 @@
 
 #include <config.h>
 
+#include <algorithm>
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "database/header.h"
 #include "database/io.h"
+#include "database/package_index.h"
 #include "database/package_reader.h"
-#include "eixTk/auto_list.h"
 #include "eixTk/diagnostics.h"
 #include "eixTk/eixint.h"
 #include "eixTk/likely.h"
@@ -28,18 +32,72 @@
 #include "portage/packagetree.h"
 #include "portage/version.h"
 
+using std::map;
+using std::pair;
 using std::string;
+using std::vector;
 
-#define WRITE_COUNTER(f) do { \
-	eix::OffsetType counter_save(counter); \
-	counter = 0; \
-	bool counting_save(counting); \
-	counting = true; \
-	f; \
-	counting = counting_save; \
-	eix::OffsetType counter_diff(counter); \
-	counter = counter_save; \
-	if(unlikely(!write_num(counter_diff, errtext))) { \
+typedef map<eix::UNumber, PackageIndex::Selection> TrigramPostings;
+typedef map<string, PackageIndex::RDepends> RDependMap;
+
+inline static void add_posting(vector<PackageIndex::Selection> *postings, StringHash::size_type index, eix::Treesize num) ATTRIBUTE_NONNULL_;
+inline static void add_posting(vector<PackageIndex::Selection> *postings, StringHash::size_type index, eix::Treesize num) {
+	PackageIndex::Selection& list((*postings)[index]);
+	// Packages are added in increasing order, possibly several times
+	if(list.empty() || (list.back() != num)) {
+		list.push_back(num);
+	}
+}
+
+static void add_postings(vector<PackageIndex::Selection> *postings, const StringHash& hash, const WordVec& words, eix::Treesize num) ATTRIBUTE_NONNULL_;
+static void add_postings(vector<PackageIndex::Selection> *postings, const StringHash& hash, const WordVec& words, eix::Treesize num) {
+	for(WordVec::const_iterator it(words.begin()); likely(it != words.end()); ++it) {
+		add_posting(postings, hash.get_index(*it), num);
+	}
+}
+
+static void add_trigram_postings(TrigramPostings *postings, const string& s, eix::Treesize num) ATTRIBUTE_NONNULL_;
+static void add_trigram_postings(TrigramPostings *postings, const string& s, eix::Treesize num) {
+	vector<eix::UNumber> trigrams;
+	PackageIndex::add_trigrams(&trigrams, s);
+	for(vector<eix::UNumber>::const_iterator it(trigrams.begin());
+		likely(it != trigrams.end()); ++it) {
+		PackageIndex::Selection& list((*postings)[*it]);
+		if(list.empty() || (list.back() != num)) {
+			list.push_back(num);
+		}
+	}
+}
+
+static void add_rdepends(RDependMap *rdepends, const string& words, eix::Treesize num, eix::UNumber version, PackageIndex::DependKinds kind) ATTRIBUTE_NONNULL_;
+static void add_rdepends(RDependMap *rdepends, const string& words, eix::Treesize num, eix::UNumber version, PackageIndex::DependKinds kind) {
+	WordVec list;
+	split_string(&list, words);
+	string key;
+	for(WordVec::const_iterator it(list.begin()); likely(it != list.end()); ++it) {
+		if(!Depend::atom_key(&key, *it)) {
+			continue;
+		}
+		PackageIndex::RDepends& entries((*rdepends)[key]);
+		// Versions are added in increasing order, possibly several times
+		if(entries.empty() || (entries.back().num != num) || (entries.back().version != version)) {
+			entries.push_back(PackageIndex::RDepend(num, version, kind));
+		} else {
+			entries.back().kinds |= kind;
+		}
+	}
+}
+
+/**
+Write the data of f preceded by its length.
+The data is written only once into the buffer and moved afterwards.
+**/
+#define WRITE_WITH_LENGTH(f) do { \
+	string::size_type length_start(begin_length()); \
+	if(unlikely(!(f))) { \
+		return false; \
+	} \
+	if(unlikely(!end_length(length_start, errtext))) { \
 		return false; \
 	} \
 } while(0)
@@ -49,18 +107,12 @@ bool Database::read_Part(BasicPart *b, string *errtext) {
 	if(unlikely(!read_num(&len, errtext))) {
 		return false;
 	}
-	BasicPart::PartType type(BasicPart::PartType(len % BasicPart::max_type));
+	b->parttype = BasicPart::PartType(len % BasicPart::max_type);
 	len /= BasicPart::max_type;
 	if(len != 0) {
-		eix::auto_list<char> buf(new char[len + 1]);
-		buf.get()[len] = 0;
-		if(unlikely(!read_string_plain(buf.get(), len, errtext))) {
-			return false;
-		}
-		*b = BasicPart(type, string(buf.get()));
-		return true;
+		return read_string_plain(&(b->partcontent), len, errtext);
 	}
-	*b = BasicPart(type);
+	b->partcontent.clear();
 	return true;
 }
 
@@ -113,11 +165,10 @@ bool Database::read_version(Version *v, const DBHeader& hdr, string *errtext) {
 		return false;
 	}
 	for(; likely(i != 0); --i) {
-		BasicPart b;
-		if(unlikely(!read_Part(&b, errtext))) {
+		v->m_parts.push_back(BasicPart());
+		if(unlikely(!read_Part(&(v->m_parts.back()), errtext))) {
 			return false;
 		}
-		v->m_parts.push_back(b);
 	}
 
 	string fullslot;
@@ -218,10 +269,7 @@ bool Database::write_version(const Version *v, const DBHeader& hdr, string *errt
 		}
 	}
 	if(hdr.use_depend) {
-		WRITE_COUNTER(write_depend(v->depend, hdr, NULLPTR));
-		if(unlikely(!write_depend(v->depend, hdr, errtext))) {
-			return false;
-		}
+		WRITE_WITH_LENGTH(write_depend(v->depend, hdr, errtext));
 	}
 	return true;
 }
@@ -232,21 +280,28 @@ bool Database::read_depend(Depend *dep, const DBHeader& hdr, string *errtext) {
 		return false;
 	}
 	if(Depend::use_depend) {
-		if(unlikely(!read_hash_words(hdr.depend_hash, &(dep->m_depend), errtext))) {
+		bool use_ids(Depend::use_ids);
+		if(unlikely(!read_hash_words(hdr.depend_hash, &(dep->m_depend),
+			(use_ids ? &(dep->m_depend_ids) : NULLPTR), errtext))) {
 			return false;
 		}
-		if(unlikely(!read_hash_words(hdr.depend_hash, &(dep->m_rdepend), errtext))) {
+		if(unlikely(!read_hash_words(hdr.depend_hash, &(dep->m_rdepend),
+			(use_ids ? &(dep->m_rdepend_ids) : NULLPTR), errtext))) {
 			return false;
 		}
-		if(unlikely(!read_hash_words(hdr.depend_hash, &(dep->m_pdepend), errtext))) {
+		if(unlikely(!read_hash_words(hdr.depend_hash, &(dep->m_pdepend),
+			(use_ids ? &(dep->m_pdepend_ids) : NULLPTR), errtext))) {
 			return false;
 		}
 		if(hdr.version == 31) {
 			dep->m_hdepend.clear();
-		} else if(unlikely(!read_hash_words(hdr.depend_hash, &(dep->m_hdepend), errtext))) {
+			dep->m_hdepend_ids.clear();
+		} else if(unlikely(!read_hash_words(hdr.depend_hash, &(dep->m_hdepend),
+			(use_ids ? &(dep->m_hdepend_ids) : NULLPTR), errtext))) {
 			return false;
 		}
 		dep->obsolete = (hdr.version <= 32);
+		dep->have_ids = use_ids;
 	} else {
 		dep->clear();
 GCC_DIAG_OFF(sign-conversion)
@@ -276,17 +331,27 @@ bool Database::write_category_header(const string& name, eix::Treesize size, str
 }
 
 bool Database::write_package_pure(const Package& pkg, const DBHeader& hdr, string *errtext) {
-	if(unlikely(!write_string(pkg.name, errtext))) {
-		return false;
-	}
-	if(unlikely(!write_string(pkg.desc, errtext))) {
-		return false;
-	}
-	if(unlikely(!write_string(pkg.homepage, errtext))) {
-		return false;
+	for(unsigned int column(0); likely(column != PackageIndex::COLUMN_SIZE); ++column) {
+		if(unlikely(!write_column(pkg, PackageIndex::Column(column), hdr, errtext))) {
+			return false;
+		}
 	}
-	if(unlikely(!write_hash_string(hdr.license_hash, pkg.licenses, errtext))) {
-		return false;
+	return true;
+}
+
+bool Database::write_column(const Package& pkg, PackageIndex::Column column, const DBHeader& hdr, string *errtext) {
+	switch(column) {
+		case PackageIndex::COLUMN_NAME:
+			return write_string(pkg.name, errtext);
+		case PackageIndex::COLUMN_DESCRIPTION:
+			return write_string(pkg.desc, errtext);
+		case PackageIndex::COLUMN_HOMEPAGE:
+			return write_string(pkg.homepage, errtext);
+		case PackageIndex::COLUMN_LICENSE:
+			return write_hash_string(hdr.license_hash, pkg.licenses, errtext);
+		default:
+		// case PackageIndex::COLUMN_VERSIONS:
+			break;
 	}
 
 	// write all version entries
@@ -302,18 +367,53 @@ bool Database::write_package_pure(const Package& pkg, const DBHeader& hdr, strin
 	return true;
 }
 
+/**
+Write all names, then all descriptions, etc.
+For each package, offsets gets the positions of its entries in all columns.
+**/
+bool Database::write_columns(const PackageTree& tree, const DBHeader& hdr, vector<eix::OffsetType> *offsets, string *errtext) {
+	offsets->resize(tree.countPackages() * PackageIndex::COLUMN_SIZE);
+	for(unsigned int column(0); likely(column != PackageIndex::COLUMN_SIZE); ++column) {
+		vector<eix::OffsetType>::size_type i(column);
+		for(PackageTree::const_iterator c(tree.begin()); likely(c != tree.end()); ++c) {
+			Category *ci(c->second);
+			for(Category::const_iterator p(ci->begin()); likely(p != ci->end()); ++p) {
+				(*offsets)[i] = tell();
+				i += PackageIndex::COLUMN_SIZE;
+				if(unlikely(!write_column(**p, PackageIndex::Column(column), hdr, errtext))) {
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
 bool Database::write_package(const Package& pkg, const DBHeader& hdr, string *errtext) {
-	WRITE_COUNTER(write_package_pure(pkg, hdr, NULLPTR));
-	return write_package_pure(pkg, hdr, errtext);
+	WRITE_WITH_LENGTH(write_package_pure(pkg, hdr, errtext));
+	return true;
 }
 
+/**
+The table of offsets allows to resolve the entries on demand
+**/
 bool Database::write_hash(const StringHash& hash, string *errtext) {
 	StringHash::size_type e(hash.size());
 	if(unlikely(!write_num(e, errtext))) {
 		return false;
 	}
+	string::size_type offset(0);
+	if(unlikely(!write_fixed(offset, HASH_OFFSET_BYTES, errtext))) {
+		return false;
+	}
 	for(StringHash::const_iterator i(hash.begin()); likely(i != hash.end()); ++i) {
-		if(unlikely(!write_string(*i, errtext))) {
+		offset += i->size();
+		if(unlikely(!write_fixed(offset, HASH_OFFSET_BYTES, errtext))) {
+			return false;
+		}
+	}
+	for(StringHash::const_iterator i(hash.begin()); likely(i != hash.end()); ++i) {
+		if(unlikely(!write_string_plain(*i, errtext))) {
 			return false;
 		}
 	}
@@ -333,6 +433,9 @@ void Database::prep_header_hashs(DBHeader *hdr, const PackageTree& tree) {
 	}
 	bool use_required_use(Version::use_required_use);
 	hdr->use_required_use = use_required_use;
+	hdr->use_trigrams = PackageIndex::use_trigrams;
+	hdr->use_columns = PackageIndex::use_columns;
+	hdr->use_rdepends = use_dep;
 	for(PackageTree::const_iterator c(tree.begin()); likely(c != tree.end()); ++c) {
 		Category *ci(c->second);
 		for(Category::iterator p(ci->begin()); likely(p != ci->end()); ++p) {
@@ -375,6 +478,11 @@ bool Database::write_header(const DBHeader& hdr, string *errtext) {
 	if(unlikely(!write_num(hdr.size, errtext))) {
 		return false;
 	}
+	// The offset of the package index is known only at the very end:
+	index_patch = tell();
+	if(unlikely(!write_fixed(eix::OffsetType(0), OFFSET_BYTES, errtext))) {
+		return false;
+	}
 
 	if(unlikely(!write_num(hdr.countOverlays(), errtext))) {
 		return false;
@@ -421,27 +529,188 @@ bool Database::write_header(const DBHeader& hdr, string *errtext) {
 	if(hdr.use_required_use) {
 		save_bitmask |= DBHeader::SAVE_BITMASK_REQUIRED_USE;
 	}
+	if(hdr.use_trigrams) {
+		save_bitmask |= DBHeader::SAVE_BITMASK_TRIGRAMS;
+	}
+	if(hdr.use_columns) {
+		save_bitmask |= DBHeader::SAVE_BITMASK_COLUMNS;
+	}
+	if(hdr.use_rdepends) {
+		save_bitmask |= DBHeader::SAVE_BITMASK_RDEPENDS;
+	}
 	if(unlikely(!write_num(save_bitmask, errtext))) {
 		return false;
 	}
 	if(!hdr.use_depend) {
 		return true;
 	}
-	WRITE_COUNTER(write_hash(hdr.depend_hash, NULLPTR));
-	return write_hash(hdr.depend_hash, errtext);
+	WRITE_WITH_LENGTH(write_hash(hdr.depend_hash, errtext));
+	return true;
 }
 
 bool Database::write_packagetree(const PackageTree& tree, const DBHeader& hdr, string *errtext) {
+	vector<eix::OffsetType> offsets;
+	if(hdr.use_columns) {
+		if(unlikely(!write_columns(tree, hdr, &offsets, errtext))) {
+			return false;
+		}
+	} else {
+		offsets.reserve(tree.countPackages());
+		for(PackageTree::const_iterator c(tree.begin()); likely(c != tree.end()); ++c) {
+			Category *ci(c->second);
+			// Write category-header followed by a list of the packages.
+			if(unlikely(!write_category_header(c->first, eix::Treesize(ci->size()), errtext))) {
+				return false;
+			}
+
+			for(Category::iterator p(ci->begin()); likely(p != ci->end()); ++p) {
+				// write package to fp
+				offsets.push_back(tell());
+				if(unlikely(!write_package(**p, hdr, errtext))) {
+					return false;
+				}
+			}
+		}
+	}
+	eix::OffsetType index_offset(tell());
+	if(unlikely(!write_package_index(tree, hdr, offsets, errtext))) {
+		return false;
+	}
+	if(likely(index_patch != 0)) {
+		if(unlikely(!(likely(seekabs(index_patch, errtext)) &&
+			likely(write_fixed(index_offset, OFFSET_BYTES, errtext))))) {
+			return false;
+		}
+	}
+	return flush(errtext);
+}
+
+/**
+The package index consists of the list of category names with the number
+of their packages, the file offsets of all packages (in file order),
+and the numbers of all packages sorted by name.
+The latter two have fixed length so that they can be bisected.
+Then for each of the hashes follow the posting lists of the packages
+using the corresponding hash entry, optionally the trigrams, and finally
+the fingerprints of the categories.
+**/
+bool Database::write_package_index(const PackageTree& tree, const DBHeader& hdr, const vector<eix::OffsetType>& offsets, string *errtext) {
+	if(unlikely(!write_num(tree.countCategories(), errtext))) {
+		return false;
+	}
+	typedef vector<pair<string, eix::Treesize> > NameIndex;
+	NameIndex names;
+	names.reserve(tree.countPackages());
+	typedef vector<PackageIndex::Selection> Postings;
+	Postings postings[PackageIndex::POSTING_SIZE];
+	postings[PackageIndex::POSTING_EAPI].resize(hdr.eapi_hash.size());
+	postings[PackageIndex::POSTING_LICENSE].resize(hdr.license_hash.size());
+	postings[PackageIndex::POSTING_IUSE].resize(hdr.iuse_hash.size());
+	postings[PackageIndex::POSTING_SLOT].resize(hdr.slot_hash.size());
+	TrigramPostings trigrams[PackageIndex::TRIGRAM_SIZE];
+	RDependMap rdepends;
 	for(PackageTree::const_iterator c(tree.begin()); likely(c != tree.end()); ++c) {
 		Category *ci(c->second);
-		// Write category-header followed by a list of the packages.
 		if(unlikely(!write_category_header(c->first, eix::Treesize(ci->size()), errtext))) {
 			return false;
 		}
+		for(Category::const_iterator p(ci->begin()); likely(p != ci->end()); ++p) {
+			eix::Treesize num(names.size());
+			names.push_back(NameIndex::value_type(p->name, num));
+			add_posting(&(postings[PackageIndex::POSTING_LICENSE]),
+				hdr.license_hash.get_index(p->licenses), num);
+			if(hdr.use_trigrams) {
+				add_trigram_postings(&(trigrams[PackageIndex::TRIGRAM_NAME]), p->name, num);
+				add_trigram_postings(&(trigrams[PackageIndex::TRIGRAM_DESCRIPTION]), p->desc, num);
+				add_trigram_postings(&(trigrams[PackageIndex::TRIGRAM_HOMEPAGE]), p->homepage, num);
+			}
+			eix::UNumber version(0);
+			for(Package::const_iterator v(p->begin()); likely(v != p->end()); ++v, ++version) {
+				if(hdr.use_rdepends) {
+					const Depend& dep(v->depend);
+					add_rdepends(&rdepends, dep.get_depend(), num, version, PackageIndex::DEPKIND_DEPEND);
+					add_rdepends(&rdepends, dep.get_rdepend(), num, version, PackageIndex::DEPKIND_RDEPEND);
+					add_rdepends(&rdepends, dep.get_pdepend(), num, version, PackageIndex::DEPKIND_PDEPEND);
+					add_rdepends(&rdepends, dep.get_hdepend(), num, version, PackageIndex::DEPKIND_HDEPEND);
+				}
+				add_posting(&(postings[PackageIndex::POSTING_EAPI]),
+					hdr.eapi_hash.get_index(v->eapi.get()), num);
+				add_postings(&(postings[PackageIndex::POSTING_IUSE]),
+					hdr.iuse_hash, v->iuse.asVector(), num);
+				add_posting(&(postings[PackageIndex::POSTING_SLOT]),
+					hdr.slot_hash.get_index(v->get_shortfullslot()), num);
+			}
+		}
+	}
+	if(unlikely(!write_num(names.size(), errtext))) {
+		return false;
+	}
+	for(vector<eix::OffsetType>::const_iterator it(offsets.begin());
+		likely(it != offsets.end()); ++it) {
+		if(unlikely(!write_fixed(*it, OFFSET_BYTES, errtext))) {
+			return false;
+		}
+	}
+	// Equal names remain in file order, since the second entry is compared then
+	std::sort(names.begin(), names.end());
+	for(NameIndex::const_iterator it(names.begin()); likely(it != names.end()); ++it) {
+		if(unlikely(!write_fixed(it->second, INDEX_BYTES, errtext))) {
+			return false;
+		}
+	}
+	for(unsigned int i(0); likely(i != PackageIndex::POSTING_SIZE); ++i) {
+		if(unlikely(!write_postings(postings[i], errtext))) {
+			return false;
+		}
+	}
+	// The sorted trigrams are followed by their posting lists
+	for(unsigned int i(0); hdr.use_trigrams && likely(i != PackageIndex::TRIGRAM_SIZE); ++i) {
+		if(unlikely(!write_num(trigrams[i].size(), errtext))) {
+			return false;
+		}
+		vector<PackageIndex::Selection> lists;
+		lists.reserve(trigrams[i].size());
+		for(TrigramPostings::iterator it(trigrams[i].begin());
+			likely(it != trigrams[i].end()); ++it) {
+			if(unlikely(!write_fixed(it->first, TRIGRAM_BYTES, errtext))) {
+				return false;
+			}
+			lists.push_back(PackageIndex::Selection());
+			lists.back().swap(it->second);
+		}
+		trigrams[i].clear();
+		if(unlikely(!write_postings(lists, errtext))) {
+			return false;
+		}
+	}
+	if(hdr.use_rdepends) {
+		if(unlikely(!write_rdepends(rdepends, errtext))) {
+			return false;
+		}
+	}
+	return write_fingerprints(tree, hdr, errtext);
+}
 
-		for(Category::iterator p(ci->begin()); likely(p != ci->end()); ++p) {
-			// write package to fp
-			if(unlikely(!write_package(**p, hdr, errtext))) {
+bool Database::write_fingerprints(const PackageTree& tree, const DBHeader& hdr, string *errtext) {
+	if(unlikely(!write_num(hdr.fingerprint_methods.size(), errtext))) {
+		return false;
+	}
+	for(WordVec::size_type i(0); likely(i != hdr.fingerprint_methods.size()); ++i) {
+		if(hdr.fingerprint_methods[i].empty() ||
+			unlikely((i >= hdr.fingerprints.size()) ||
+				(hdr.fingerprints[i].size() != tree.countCategories()))) {
+			if(unlikely(!write_string(string(), errtext))) {
+				return false;
+			}
+			continue;
+		}
+		const vector<eix::UNumber>& fingerprints(hdr.fingerprints[i]);
+		if(unlikely(!write_string(hdr.fingerprint_methods[i], errtext))) {
+			return false;
+		}
+		for(vector<eix::UNumber>::const_iterator it(fingerprints.begin());
+			likely(it != fingerprints.end()); ++it) {
+			if(unlikely(!write_fixed(*it, FINGERPRINT_BYTES, errtext))) {
 				return false;
 			}
 		}
@@ -449,6 +718,98 @@ bool Database::write_packagetree(const PackageTree& tree, const DBHeader& hdr, s
 	return true;
 }
 
+/**
+A table of the offsets of the posting lists (and of their end) is
+followed by the lists. Since the lengths are known only after writing,
+the table is patched afterwards.
+Each list stores its first package number and then the differences.
+**/
+bool Database::write_postings(const vector<PackageIndex::Selection>& postings, string *errtext) {
+	if(unlikely(!write_num(postings.size(), errtext))) {
+		return false;
+	}
+	eix::OffsetType table(tell());
+	for(vector<PackageIndex::Selection>::size_type i(0); likely(i <= postings.size()); ++i) {
+		if(unlikely(!write_fixed(eix::OffsetType(0), OFFSET_BYTES, errtext))) {
+			return false;
+		}
+	}
+	vector<eix::OffsetType> offsets;
+	offsets.reserve(postings.size() + 1);
+	for(vector<PackageIndex::Selection>::const_iterator it(postings.begin());
+		likely(it != postings.end()); ++it) {
+		offsets.push_back(tell());
+		if(unlikely(!write_num(it->size(), errtext))) {
+			return false;
+		}
+		eix::Treesize prev(0);
+		for(PackageIndex::Selection::const_iterator num(it->begin());
+			likely(num != it->end()); ++num) {
+			if(unlikely(!write_num(*num - prev, errtext))) {
+				return false;
+			}
+			prev = *num;
+		}
+	}
+	offsets.push_back(tell());
+	return patch_offsets(table, offsets, errtext);
+}
+
+/**
+The sorted names of the packages depended on are stored like a hash.
+They are followed by a table of offsets as for postings and the lists
+of the versions depending on them.
+**/
+bool Database::write_rdepends(const RDependMap& rdepends, string *errtext) {
+	StringHash names(false);
+	for(RDependMap::const_iterator it(rdepends.begin()); likely(it != rdepends.end()); ++it) {
+		names.store_string(it->first);
+	}
+	if(unlikely(!(write_hash(names, errtext) &&
+		write_num(rdepends.size(), errtext)))) {
+		return false;
+	}
+	eix::OffsetType table(tell());
+	for(RDependMap::size_type i(0); likely(i <= rdepends.size()); ++i) {
+		if(unlikely(!write_fixed(eix::OffsetType(0), OFFSET_BYTES, errtext))) {
+			return false;
+		}
+	}
+	vector<eix::OffsetType> offsets;
+	offsets.reserve(rdepends.size() + 1);
+	for(RDependMap::const_iterator it(rdepends.begin()); likely(it != rdepends.end()); ++it) {
+		offsets.push_back(tell());
+		if(unlikely(!write_num(it->second.size(), errtext))) {
+			return false;
+		}
+		eix::Treesize prev(0);
+		for(PackageIndex::RDepends::const_iterator entry(it->second.begin());
+			likely(entry != it->second.end()); ++entry) {
+			if(unlikely(!(write_num(entry->num - prev, errtext) &&
+				write_num(entry->version, errtext) &&
+				write_num(entry->kinds, errtext)))) {
+				return false;
+			}
+			prev = entry->num;
+		}
+	}
+	offsets.push_back(tell());
+	return patch_offsets(table, offsets, errtext);
+}
+
+bool Database::patch_offsets(eix::OffsetType table, const vector<eix::OffsetType>& offsets, string *errtext) {
+	if(unlikely(!seekabs(table, errtext))) {
+		return false;
+	}
+	for(vector<eix::OffsetType>::const_iterator it(offsets.begin());
+		likely(it != offsets.end()); ++it) {
+		if(unlikely(!write_fixed(*it, OFFSET_BYTES, errtext))) {
+			return false;
+		}
+	}
+	return seekabs(offsets.back(), errtext);
+}
+
 bool Database::read_packagetree(PackageTree *tree, const DBHeader& hdr, PortageSettings *ps, string *errtext) {
 	PackageReader reader(this, hdr, ps);
 	while(reader.nextCategory()) {
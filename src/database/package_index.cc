@@ -0,0 +1,495 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#include <config.h>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "database/header.h"
+#include "database/io.h"
+#include "database/package_index.h"
+#include "eixTk/eixint.h"
+#include "eixTk/i18n.h"
+#include "eixTk/likely.h"
+#include "eixTk/null.h"
+#include "eixTk/stringtypes.h"
+
+using std::string;
+using std::vector;
+
+const PackageIndex::DependKinds
+	PackageIndex::DEPKIND_NONE,
+	PackageIndex::DEPKIND_DEPEND,
+	PackageIndex::DEPKIND_RDEPEND,
+	PackageIndex::DEPKIND_PDEPEND,
+	PackageIndex::DEPKIND_HDEPEND;
+
+bool PackageIndex::use_trigrams;
+bool PackageIndex::use_columns;
+
+bool PackageIndex::init(const DBHeader& hdr) {
+	m_valid = false;
+	if(hdr.index_offset == 0) {
+		return false;
+	}
+	if(unlikely(!m_db->seekabs(hdr.index_offset, NULLPTR))) {
+		return false;
+	}
+	eix::Catsize count;
+	if(unlikely(!m_db->read_num(&count, NULLPTR))) {
+		return false;
+	}
+	m_categories.resize(count);
+	m_first.resize(count);
+	eix::Treesize first(0);
+	for(eix::Catsize c(0); likely(c != count); ++c) {
+		eix::Treesize size;
+		if(unlikely(!m_db->read_category_header(&(m_categories[c]), &size, NULLPTR))) {
+			return false;
+		}
+		m_first[c] = first;
+		first += size;
+	}
+	if(unlikely(!m_db->read_num(&m_size, NULLPTR))) {
+		return false;
+	}
+	if(unlikely(m_size != first)) {
+		return false;
+	}
+	m_columns = (hdr.use_columns ? COLUMN_SIZE : 1);
+	m_offsets = m_db->tell();
+	m_names = m_offsets + static_cast<eix::OffsetType>(m_size * m_columns * OFFSET_BYTES);
+	// Each offset table of posting lists ends with the offset of the next one
+	eix::OffsetType next(m_names + static_cast<eix::OffsetType>(m_size * INDEX_BYTES));
+	for(unsigned int i(0); likely(i != POSTING_SIZE); ++i) {
+		if(unlikely(!read_postings_table(&next, &(m_postings[i]), &(m_postings_size[i])))) {
+			return false;
+		}
+	}
+	m_trigrams = hdr.use_trigrams;
+	if(m_trigrams) {
+		for(unsigned int i(0); likely(i != TRIGRAM_SIZE); ++i) {
+			if(unlikely(!(m_db->seekabs(next, NULLPTR) &&
+				m_db->read_num(&(m_trigram_size[i]), NULLPTR)))) {
+				return false;
+			}
+			m_trigram_keys[i] = m_db->tell();
+			next = m_trigram_keys[i] + static_cast<eix::OffsetType>(m_trigram_size[i] * TRIGRAM_BYTES);
+			eix::UNumber size;
+			if(unlikely(!read_postings_table(&next, &(m_trigram_postings[i]), &size))) {
+				return false;
+			}
+			if(unlikely(size != m_trigram_size[i])) {
+				return false;
+			}
+		}
+	}
+	m_rdepends = hdr.use_rdepends;
+	if(m_rdepends) {
+		// The names are stored like a hash
+		if(unlikely(!(m_db->seekabs(next, NULLPTR) &&
+			m_db->read_num(&m_rdepend_size, NULLPTR)))) {
+			return false;
+		}
+		m_rdepend_keys = m_db->tell();
+		m_rdepend_names = m_rdepend_keys + static_cast<eix::OffsetType>((m_rdepend_size + 1) * HASH_OFFSET_BYTES);
+		eix::OffsetType len;
+		if(unlikely(!(m_db->seekabs(m_rdepend_names - HASH_OFFSET_BYTES, NULLPTR) &&
+			m_db->read_fixed(&len, HASH_OFFSET_BYTES, NULLPTR)))) {
+			return false;
+		}
+		next = m_rdepend_names + len;
+		eix::UNumber size;
+		if(unlikely(!read_postings_table(&next, &m_rdepend_postings, &size))) {
+			return false;
+		}
+		if(unlikely(size != m_rdepend_size)) {
+			return false;
+		}
+	}
+	m_fingerprints = next;
+	m_overlays = hdr.countOverlays();
+	return (m_valid = true);
+}
+
+bool PackageIndex::read_fingerprints(WordVec *methods, vector<vector<eix::UNumber> > *fingerprints) {
+	eix::UNumber count;
+	if(unlikely(!(m_db->seekabs(m_fingerprints, NULLPTR) &&
+		m_db->read_num(&count, NULLPTR)))) {
+		return false;
+	}
+	if(unlikely(count != m_overlays)) {
+		return false;
+	}
+	methods->assign(count, string());
+	fingerprints->assign(count, vector<eix::UNumber>());
+	for(eix::UNumber i(0); likely(i != count); ++i) {
+		if(unlikely(!m_db->read_string(&((*methods)[i]), NULLPTR))) {
+			return false;
+		}
+		if((*methods)[i].empty()) {
+			continue;
+		}
+		vector<eix::UNumber>& list((*fingerprints)[i]);
+		list.resize(m_categories.size());
+		for(vector<eix::UNumber>::iterator it(list.begin()); likely(it != list.end()); ++it) {
+			if(unlikely(!m_db->read_fixed(&(*it), FINGERPRINT_BYTES, NULLPTR))) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool PackageIndex::read_postings_table(eix::OffsetType *next, eix::OffsetType *table, eix::UNumber *size) {
+	if(unlikely(!(m_db->seekabs(*next, NULLPTR) &&
+		m_db->read_num(size, NULLPTR)))) {
+		return false;
+	}
+	*table = m_db->tell();
+	return (likely(m_db->seekabs(*table + static_cast<eix::OffsetType>(*size * OFFSET_BYTES), NULLPTR)) &&
+		likely(m_db->read_fixed(next, OFFSET_BYTES, NULLPTR)));
+}
+
+bool PackageIndex::read_posting(Selection *sel, eix::OffsetType table, eix::UNumber size, eix::UNumber id) {
+	if(unlikely(id >= size)) {
+		return false;
+	}
+	eix::OffsetType list;
+	if(unlikely(!(m_db->seekabs(table + static_cast<eix::OffsetType>(id * OFFSET_BYTES), NULLPTR) &&
+		m_db->read_fixed(&list, OFFSET_BYTES, NULLPTR) &&
+		m_db->seekabs(list, NULLPTR)))) {
+		return false;
+	}
+	eix::Treesize count;
+	if(unlikely(!m_db->read_num(&count, NULLPTR))) {
+		return false;
+	}
+	for(eix::Treesize num(0); likely(count != 0); --count) {
+		eix::Treesize diff;
+		if(unlikely(!m_db->read_num(&diff, NULLPTR))) {
+			return false;
+		}
+		num += diff;
+		sel->push_back(num);
+	}
+	return true;
+}
+
+bool PackageIndex::read_offset(eix::Treesize i, eix::OffsetType *offset, string *errtext) {
+	return (likely(m_db->seekabs(m_offsets + static_cast<eix::OffsetType>(i * m_columns * OFFSET_BYTES), errtext)) &&
+		likely(m_db->read_fixed(offset, OFFSET_BYTES, errtext)));
+}
+
+bool PackageIndex::read_name(eix::Treesize j, eix::Treesize *i, string *name) {
+	if(unlikely(!m_db->seekabs(m_names + static_cast<eix::OffsetType>(j * INDEX_BYTES), NULLPTR))) {
+		return false;
+	}
+	if(unlikely(!m_db->read_fixed(i, INDEX_BYTES, NULLPTR))) {
+		return false;
+	}
+	if(unlikely(*i >= m_size)) {
+		return false;
+	}
+	eix::OffsetType offset;
+	if(unlikely(!read_offset(*i, &offset, NULLPTR))) {
+		return false;
+	}
+	if(unlikely(!m_db->seekabs(offset, NULLPTR))) {
+		return false;
+	}
+	if(m_columns == 1) {
+		// Skip the length of the package entry; the name comes first
+		eix::OffsetType len;
+		if(unlikely(!m_db->read_num(&len, NULLPTR))) {
+			return false;
+		}
+	}
+	return m_db->read_string(name, NULLPTR);
+}
+
+bool PackageIndex::select_name(Selection *sel, const string& name, bool exact, eix::Treesize first, eix::Treesize last) {
+	if(unlikely(!m_valid)) {
+		return false;
+	}
+	// Bisect for the first name which is not smaller than name
+	eix::Treesize lower(0), upper(m_size);
+	string curr;
+	eix::Treesize i;
+	while(lower != upper) {
+		eix::Treesize middle(lower + (upper - lower) / 2);
+		if(unlikely(!read_name(middle, &i, &curr))) {
+			return false;
+		}
+		if(curr < name) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	for(; likely(lower != m_size); ++lower) {
+		if(unlikely(!read_name(lower, &i, &curr))) {
+			return false;
+		}
+		if(exact ? (curr != name) : (curr.compare(0, name.size(), name) != 0)) {
+			break;
+		}
+		if((i >= first) && (i < last)) {
+			sel->push_back(i);
+		}
+	}
+	return true;
+}
+
+bool PackageIndex::select_name(Selection *sel, const string& name, bool exact) {
+	return select_name(sel, name, exact, 0, m_size);
+}
+
+void PackageIndex::select_category(Selection *sel, const string& cat, bool exact) const {
+	for(WordVec::size_type c(0); likely(c != m_categories.size()); ++c) {
+		const string& curr(m_categories[c]);
+		if(exact ? (curr != cat) : (curr.compare(0, cat.size(), cat) != 0)) {
+			continue;
+		}
+		eix::Treesize last((c + 1 == m_categories.size()) ? m_size : m_first[c + 1]);
+		for(eix::Treesize i(m_first[c]); likely(i != last); ++i) {
+			sel->push_back(i);
+		}
+	}
+}
+
+bool PackageIndex::select_category_name(Selection *sel, const string& s, bool exact) {
+	string::size_type slash(s.find('/'));
+	if(slash == string::npos) {
+		// category/name cannot equal s, but it starts with s
+		// if and only if the category does
+		if(!exact) {
+			select_category(sel, s, false);
+		}
+		return true;
+	}
+	WordVec::size_type c(find_category(s.substr(0, slash)));
+	if(c == m_categories.size()) {
+		return true;
+	}
+	eix::Treesize last((c + 1 == m_categories.size()) ? m_size : m_first[c + 1]);
+	return select_name(sel, s.substr(slash + 1), exact, m_first[c], last);
+}
+
+WordVec::size_type PackageIndex::find_category(const string& cat) const {
+	WordVec::const_iterator it(std::lower_bound(m_categories.begin(), m_categories.end(), cat));
+	if((it == m_categories.end()) || (*it != cat)) {
+		return m_categories.size();
+	}
+	return (it - m_categories.begin());
+}
+
+bool PackageIndex::select_postings(Selection *sel, PostingType type, const vector<eix::UNumber>& ids) {
+	if(unlikely(!m_valid)) {
+		return false;
+	}
+	for(vector<eix::UNumber>::const_iterator it(ids.begin()); likely(it != ids.end()); ++it) {
+		if(unlikely(!read_posting(sel, m_postings[type], m_postings_size[type], *it))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool PackageIndex::find_trigram(eix::UNumber *id, TrigramType type, eix::UNumber trigram) {
+	eix::UNumber lower(0), upper(m_trigram_size[type]);
+	*id = upper;
+	while(lower != upper) {
+		eix::UNumber middle(lower + (upper - lower) / 2);
+		eix::UNumber curr;
+		if(unlikely(!(m_db->seekabs(m_trigram_keys[type] + static_cast<eix::OffsetType>(middle * TRIGRAM_BYTES), NULLPTR) &&
+			m_db->read_fixed(&curr, TRIGRAM_BYTES, NULLPTR)))) {
+			return false;
+		}
+		if(curr == trigram) {
+			*id = middle;
+			break;
+		}
+		if(curr < trigram) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	return true;
+}
+
+/**
+The candidates of an alternative are the intersection of the posting
+lists of its trigrams; a missing trigram means that there are none.
+**/
+bool PackageIndex::select_trigrams(Selection *sel, TrigramType type, const vector<WordVec>& alternatives) {
+	if(unlikely(!m_valid) || !m_trigrams) {
+		return false;
+	}
+	for(vector<WordVec>::const_iterator alt(alternatives.begin());
+		likely(alt != alternatives.end()); ++alt) {
+		vector<eix::UNumber> trigrams;
+		for(WordVec::const_iterator it(alt->begin()); likely(it != alt->end()); ++it) {
+			add_trigrams(&trigrams, *it);
+		}
+		if(trigrams.empty()) {
+			return false;
+		}
+		std::sort(trigrams.begin(), trigrams.end());
+		trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+		Selection candidates;
+		for(vector<eix::UNumber>::const_iterator it(trigrams.begin());
+			likely(it != trigrams.end()); ++it) {
+			eix::UNumber id;
+			if(unlikely(!find_trigram(&id, type, *it))) {
+				return false;
+			}
+			if(id == m_trigram_size[type]) {
+				candidates.clear();
+				break;
+			}
+			Selection list;
+			if(unlikely(!read_posting(&list, m_trigram_postings[type], m_trigram_size[type], id))) {
+				return false;
+			}
+			if(it == trigrams.begin()) {
+				candidates.swap(list);
+			} else {
+				Selection both;
+				std::set_intersection(candidates.begin(), candidates.end(),
+					list.begin(), list.end(), std::back_inserter(both));
+				candidates.swap(both);
+			}
+			if(candidates.empty()) {
+				break;
+			}
+		}
+		sel->insert(sel->end(), candidates.begin(), candidates.end());
+	}
+	return true;
+}
+
+bool PackageIndex::find_rdepend(eix::UNumber *id, const string& name) {
+	eix::UNumber lower(0), upper(m_rdepend_size);
+	*id = upper;
+	string curr;
+	while(lower != upper) {
+		eix::UNumber middle(lower + (upper - lower) / 2);
+		eix::OffsetType start, end;
+		if(unlikely(!(m_db->seekabs(m_rdepend_keys + static_cast<eix::OffsetType>(middle * HASH_OFFSET_BYTES), NULLPTR) &&
+			m_db->read_fixed(&start, HASH_OFFSET_BYTES, NULLPTR) &&
+			m_db->read_fixed(&end, HASH_OFFSET_BYTES, NULLPTR) &&
+			(start <= end) &&
+			m_db->seekabs(m_rdepend_names + start, NULLPTR) &&
+			m_db->read_string_plain(&curr, static_cast<string::size_type>(end - start), NULLPTR)))) {
+			return false;
+		}
+		if(curr == name) {
+			*id = middle;
+			break;
+		}
+		if(curr < name) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	return true;
+}
+
+/**
+Each list consists of the number of its entries followed by the entries:
+the difference of the package number to that of the previous entry,
+the index of the version, and the kinds of dependencies.
+**/
+bool PackageIndex::select_rdepends(RDepends *list, const string& name) {
+	if(unlikely(!m_valid) || !m_rdepends) {
+		return false;
+	}
+	eix::UNumber id;
+	if(unlikely(!find_rdepend(&id, name))) {
+		return false;
+	}
+	if(id == m_rdepend_size) {
+		return true;
+	}
+	eix::OffsetType offset;
+	if(unlikely(!(m_db->seekabs(m_rdepend_postings + static_cast<eix::OffsetType>(id * OFFSET_BYTES), NULLPTR) &&
+		m_db->read_fixed(&offset, OFFSET_BYTES, NULLPTR) &&
+		m_db->seekabs(offset, NULLPTR)))) {
+		return false;
+	}
+	eix::UNumber count;
+	if(unlikely(!m_db->read_num(&count, NULLPTR))) {
+		return false;
+	}
+	for(eix::Treesize num(0); likely(count != 0); --count) {
+		eix::Treesize diff;
+		eix::UNumber version;
+		DependKinds kinds;
+		if(unlikely(!(m_db->read_num(&diff, NULLPTR) &&
+			m_db->read_num(&version, NULLPTR) &&
+			m_db->read_num(&kinds, NULLPTR)))) {
+			return false;
+		}
+		num += diff;
+		list->push_back(RDepend(num, version, kinds));
+	}
+	return true;
+}
+
+bool PackageIndex::locate(eix::Treesize i, const string **category, eix::OffsetType *offset, string *errtext) {
+	if(unlikely(i >= m_size)) {
+		if(errtext != NULLPTR) {
+			*errtext = _("error while reading from database");
+		}
+		return false;
+	}
+	// Empty categories share their first number with the next one
+	vector<eix::Treesize>::size_type c(std::upper_bound(m_first.begin(), m_first.end(), i) - m_first.begin());
+	*category = &(m_categories[c - 1]);
+	return read_offset(i, offset, errtext);
+}
+
+bool PackageIndex::column_offset(eix::Treesize i, Column column, eix::OffsetType *offset, string *errtext) {
+	if(unlikely((i >= m_size) || (m_columns != COLUMN_SIZE))) {
+		if(errtext != NULLPTR) {
+			*errtext = _("error while reading from database");
+		}
+		return false;
+	}
+	return (likely(m_db->seekabs(m_offsets + static_cast<eix::OffsetType>((i * COLUMN_SIZE + column) * OFFSET_BYTES), errtext)) &&
+		likely(m_db->read_fixed(offset, OFFSET_BYTES, errtext)));
+}
+
+void PackageIndex::normalize(Selection *sel) {
+	std::sort(sel->begin(), sel->end());
+	sel->erase(std::unique(sel->begin(), sel->end()), sel->end());
+}
+
+void PackageIndex::add_trigrams(vector<eix::UNumber> *trigrams, const string& s) {
+	eix::UNumber trigram(0);
+	string::size_type ascii(0);
+	for(string::const_iterator it(s.begin()); likely(it != s.end()); ++it) {
+		eix::UChar c(static_cast<eix::UChar>(*it));
+		if(unlikely(c >= 0x80U)) {
+			ascii = 0;
+			continue;
+		}
+		if((c >= 'A') && (c <= 'Z')) {
+			c += 'a' - 'A';
+		}
+		trigram = ((trigram << 8) | c) & 0xFFFFFFU;
+		if(++ascii >= 3) {
+			trigrams->push_back(trigram);
+		}
+	}
+}
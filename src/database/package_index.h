@@ -0,0 +1,306 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#ifndef SRC_DATABASE_PACKAGE_INDEX_H_
+#define SRC_DATABASE_PACKAGE_INDEX_H_ 1
+
+#include <string>
+#include <vector>
+
+#include "eixTk/constexpr.h"
+#include "eixTk/eixint.h"
+#include "eixTk/null.h"
+#include "eixTk/stringtypes.h"
+
+class Database;
+class DBHeader;
+
+/**
+Random access to the packages of the database by the package index
+which is stored at the end of the file.
+Packages are identified by their number in file order.
+**/
+class PackageIndex {
+	public:
+		/**
+		A sorted list of package numbers without duplicates
+		**/
+		typedef std::vector<eix::Treesize> Selection;
+
+		/**
+		The hashes of the header for which posting lists are stored
+		**/
+		enum PostingType {
+			POSTING_EAPI,
+			POSTING_LICENSE,
+			POSTING_IUSE,
+			POSTING_SLOT,
+			POSTING_SIZE
+		};
+
+		/**
+		The fields for which trigram indices are stored
+		**/
+		enum TrigramType {
+			TRIGRAM_NAME,
+			TRIGRAM_DESCRIPTION,
+			TRIGRAM_HOMEPAGE,
+			TRIGRAM_SIZE
+		};
+
+		/**
+		The columns of the columnar layout in file order
+		**/
+		enum Column {
+			COLUMN_NAME,
+			COLUMN_DESCRIPTION,
+			COLUMN_HOMEPAGE,
+			COLUMN_LICENSE,
+			COLUMN_VERSIONS,
+			COLUMN_SIZE
+		};
+
+		/**
+		The kinds of dependencies in the reverse dependency index
+		**/
+		typedef eix::UNumber DependKinds;
+		static CONSTEXPR DependKinds
+			DEPKIND_NONE    = 0x00U,
+			DEPKIND_DEPEND  = 0x01U,
+			DEPKIND_RDEPEND = 0x02U,
+			DEPKIND_PDEPEND = 0x04U,
+			DEPKIND_HDEPEND = 0x08U;
+
+		/**
+		A version which depends on some package
+		**/
+		class RDepend {
+			public:
+				/**
+				The number of the package and the index of the version
+				in the list of its versions
+				**/
+				eix::Treesize num;
+				eix::UNumber version;
+				DependKinds kinds;
+
+				RDepend(eix::Treesize n, eix::UNumber v, DependKinds k) : num(n), version(v), kinds(k) {
+				}
+		};
+
+		/**
+		Sorted by package number and version index
+		**/
+		typedef std::vector<RDepend> RDepends;
+
+		/**
+		Whether eix-update shall store trigram indices
+		**/
+		static bool use_trigrams;
+
+		/**
+		Whether eix-update shall use the columnar layout
+		**/
+		static bool use_columns;
+
+		explicit PackageIndex(Database *db) : m_db(db), m_size(0), m_columns(1), m_trigrams(false), m_rdepends(false), m_valid(false) {
+		}
+
+		/**
+		Read the categories and the positions of the tables of the index.
+		@return false if the database has no (usable) index
+		**/
+		bool init(const DBHeader& hdr);
+
+		bool valid() const {
+			return m_valid;
+		}
+
+		const WordVec& categories() const {
+			return m_categories;
+		}
+
+		/**
+		@return number of packages
+		**/
+		eix::Treesize size() const {
+			return m_size;
+		}
+
+		/**
+		@return number of packages in the c-th category
+		**/
+		eix::Treesize category_size(WordVec::size_type c) const {
+			return (((c + 1 == m_categories.size()) ? m_size : m_first[c + 1]) - m_first[c]);
+		}
+
+		/**
+		Add all packages whose name is name (or starts with name)
+		@return false if the index cannot be read
+		**/
+		bool select_name(Selection *sel, const std::string& name, bool exact) ATTRIBUTE_NONNULL((2));
+
+		/**
+		Add all packages whose category is cat (or starts with cat)
+		**/
+		void select_category(Selection *sel, const std::string& cat, bool exact) const ATTRIBUTE_NONNULL((2));
+
+		/**
+		Add all packages whose category/name is s (or starts with s)
+		@return false if the index cannot be read
+		**/
+		bool select_category_name(Selection *sel, const std::string& s, bool exact) ATTRIBUTE_NONNULL((2));
+
+		/**
+		Add all packages using one of the entries ids
+		of the hash corresponding to type
+		@return false if the index cannot be read
+		**/
+		bool select_postings(Selection *sel, PostingType type, const std::vector<eix::UNumber>& ids) ATTRIBUTE_NONNULL((2));
+
+		/**
+		Add all packages whose field type may contain (up to case)
+		all strings of at least one entry of alternatives
+		@return false if there is no restriction, e.g. if some entry
+		is too short or the database has no trigram index
+		**/
+		bool select_trigrams(Selection *sel, TrigramType type, const std::vector<WordVec>& alternatives) ATTRIBUTE_NONNULL((2));
+
+		/**
+		@return true if the index contains reverse dependencies
+		**/
+		bool have_rdepends() const {
+			return m_rdepends;
+		}
+
+		/**
+		Add the versions which depend on the package category/name
+		to list (in the sort order of RDepends)
+		@return false if the index cannot be read
+		**/
+		bool select_rdepends(RDepends *list, const std::string& name) ATTRIBUTE_NONNULL((2));
+
+		/**
+		Get category and file offset of package number i
+		**/
+		bool locate(eix::Treesize i, const std::string **category, eix::OffsetType *offset, std::string *errtext) ATTRIBUTE_NONNULL((3, 4));
+
+		/**
+		Get the file offset of column of package number i
+		in the columnar layout
+		**/
+		bool column_offset(eix::Treesize i, Column column, eix::OffsetType *offset, std::string *errtext) ATTRIBUTE_NONNULL((4));
+
+		/**
+		Read the cache methods of all overlays and the fingerprints
+		of their categories (in the order of categories()) if the
+		method is nonempty
+		**/
+		bool read_fingerprints(WordVec *methods, std::vector<std::vector<eix::UNumber> > *fingerprints) ATTRIBUTE_NONNULL_;
+
+		/**
+		Make sel sorted and free of duplicates
+		**/
+		static void normalize(Selection *sel) ATTRIBUTE_NONNULL_;
+
+		/**
+		Add the trigrams of s to trigrams.
+		Only ASCII characters are considered, and letters are lowercased.
+		**/
+		static void add_trigrams(std::vector<eix::UNumber> *trigrams, const std::string& s) ATTRIBUTE_NONNULL_;
+
+	private:
+		Database *m_db;
+
+		/**
+		Names of the categories and the number of their first package
+		**/
+		WordVec m_categories;
+		std::vector<eix::Treesize> m_first;
+
+		eix::Treesize m_size;
+		eix::OffsetType m_offsets, m_names;
+
+		/**
+		Number of offsets per package: COLUMN_SIZE for the columnar layout
+		**/
+		unsigned int m_columns;
+
+		/**
+		Position and size of the offset tables of the posting lists
+		**/
+		eix::OffsetType m_postings[POSTING_SIZE];
+		eix::UNumber m_postings_size[POSTING_SIZE];
+
+		/**
+		Position of the sorted trigrams and of the offset tables
+		of their posting lists
+		**/
+		eix::OffsetType m_trigram_keys[TRIGRAM_SIZE], m_trigram_postings[TRIGRAM_SIZE];
+		eix::UNumber m_trigram_size[TRIGRAM_SIZE];
+
+		/**
+		Position of the offsets and of the data of the sorted names of
+		the packages depended on, and of the offset table of the lists
+		of the versions depending on them
+		**/
+		eix::OffsetType m_rdepend_keys, m_rdepend_names, m_rdepend_postings;
+		eix::UNumber m_rdepend_size;
+
+		/**
+		Position of the fingerprints and the number of overlays
+		**/
+		eix::OffsetType m_fingerprints;
+		eix::UNumber m_overlays;
+
+		bool m_trigrams, m_rdepends, m_valid;
+
+		/**
+		Read position and size of the offset table of posting lists
+		at next and set next to the position behind the lists
+		**/
+		bool read_postings_table(eix::OffsetType *next, eix::OffsetType *table, eix::UNumber *size) ATTRIBUTE_NONNULL_;
+
+		/**
+		Add the posting list id of the table to sel
+		**/
+		bool read_posting(Selection *sel, eix::OffsetType table, eix::UNumber size, eix::UNumber id) ATTRIBUTE_NONNULL((2));
+
+		/**
+		Bisect for the number of trigram in the keys of type;
+		it is set to m_trigram_size[type] if trigram does not occur
+		@return false if the index cannot be read
+		**/
+		bool find_trigram(eix::UNumber *id, TrigramType type, eix::UNumber trigram) ATTRIBUTE_NONNULL((2));
+
+		/**
+		Bisect for the number of name in the reverse dependency index;
+		it is set to m_rdepend_size if name does not occur
+		@return false if the index cannot be read
+		**/
+		bool find_rdepend(eix::UNumber *id, const std::string& name) ATTRIBUTE_NONNULL((2));
+
+		bool read_offset(eix::Treesize i, eix::OffsetType *offset, std::string *errtext) ATTRIBUTE_NONNULL((3));
+
+		/**
+		Get number i and name of the j-th package in the name-sorted list
+		**/
+		bool read_name(eix::Treesize j, eix::Treesize *i, std::string *name) ATTRIBUTE_NONNULL((3, 4));
+
+		/**
+		Add all packages in the category range [first, last) with
+		name name (or starting with name)
+		**/
+		bool select_name(Selection *sel, const std::string& name, bool exact, eix::Treesize first, eix::Treesize last) ATTRIBUTE_NONNULL((2));
+
+		/**
+		@return number of category cat or m_categories.size()
+		**/
+		WordVec::size_type find_category(const std::string& cat) const ATTRIBUTE_PURE;
+};
+
+#endif  // SRC_DATABASE_PACKAGE_INDEX_H_
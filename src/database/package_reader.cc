@@ -9,86 +9,127 @@
 
 #include <config.h>
 
+#include <string>
+
 #include "database/io.h"
+#include "database/package_index.h"
 #include "database/package_reader.h"
 #include "eixTk/eixint.h"
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
+#include "eixTk/stats.h"
 #include "portage/conf/portagesettings.h"
 #include "portage/package.h"
 #include "portage/version.h"
 
 PackageReader::~PackageReader() {
 	delete m_pkg;
+	delete m_own_index;
+}
+
+void PackageReader::init_columns() {
+	m_columns = header->use_columns;
+	m_own_index = NULLPTR;
+	m_cat = 0;
+	m_num = m_count = 0;
+	for(unsigned int i(0); likely(i != PackageIndex::COLUMN_SIZE); ++i) {
+		m_cursor[i] = 0;
+	}
 }
 
 bool PackageReader::read(Attributes need) {
 	if(likely(m_have >= need)) {  // Already got this one
 		return true;
 	}
+	unsigned int last((need < VERSIONS) ? need : VERSIONS);
+	for(unsigned int a(m_have); likely(a != last); ) {
+		if(unlikely(!read_attribute(Attributes(++a)))) {
+			m_error = true;
+			return false;
+		}
+	}
+	m_have = need;
+	return true;
+}
 
-	switch(m_have) {
-		case NONE:
+bool PackageReader::read_attribute(Attributes a) {
+	if(m_columns && unlikely(!seek_column(a))) {
+		return false;
+	}
+	switch(a) {
+		case NAME:
 			if(unlikely(!m_db->read_string(&(m_pkg->name), &m_errtext))) {
-				m_error = true;
 				return false;
 			}
-			if(unlikely(need == NAME))
-				break;
-		case NAME:
+			break;
+		case DESCRIPTION:
 			if(unlikely(!m_db->read_string(&(m_pkg->desc), &m_errtext))) {
-				m_error = true;
 				return false;
 			}
-			if(unlikely(need == DESCRIPTION))
-				break;
-		case DESCRIPTION:
+			break;
+		case HOMEPAGE:
 			if(unlikely(!m_db->read_string(&(m_pkg->homepage), &m_errtext))) {
-				m_error = true;
 				return false;
 			}
-			if(unlikely(need == HOMEPAGE))
-				break;
-		case HOMEPAGE:
+			break;
+		case LICENSE:
 			if(unlikely(!m_db->read_hash_string(header->license_hash, &(m_pkg->licenses), &m_errtext))) {
-				m_error = true;
 				return false;
 			}
-			if(unlikely(need == LICENSE))
-				break;
-		case LICENSE: {
+			break;
+		default: {
+		// case VERSIONS:
 				eix::Versize i;
 				if(unlikely(!m_db->read_num(&i, &m_errtext))) {
-					m_error = true;
 					return false;
 				}
 				for(; likely(i != 0); --i) {
 					Version *v(new Version());
 					if(unlikely(!m_db->read_version(v, *header, &m_errtext))) {
-						m_error = true;
+						delete v;
 						return false;
 					}
 					m_pkg->addVersion(v);
 				}
 			}
-			if(likely(m_portagesettings != NULLPTR)) {
-				m_portagesettings->calc_local_sets(m_pkg);
-				m_portagesettings->finalize(m_pkg);
-			} else {
-				m_pkg->finalize_masks();
+			Stats::count(Stats::PACKAGES_DECODED);
+			{
+				StatsTimer timer(Stats::PHASE_MASKS);
+				if(likely(m_portagesettings != NULLPTR)) {
+					m_portagesettings->calc_local_sets(m_pkg);
+					m_portagesettings->finalize(m_pkg);
+				} else {
+					m_pkg->finalize_masks();
+				}
 			}
 			m_pkg->save_maskflags(Version::SAVEMASK_FILE);
-		default:
-		// case ALL:
 			break;
 	}
-	m_have = need;
+	if(m_columns) {
+		PackageIndex::Column column(PackageIndex::Column(a - NAME));
+		m_cursor[column] = m_db->tell();
+		m_cursor_num[column] = m_num + 1;
+	}
 	return true;
 }
 
+/**
+If the previous package was read from the same column,
+the entry follows immediately; otherwise ask the index.
+**/
+bool PackageReader::seek_column(Attributes a) {
+	PackageIndex::Column column(PackageIndex::Column(a - NAME));
+	if((m_cursor[column] == 0) || (m_cursor_num[column] != m_num)) {
+		if(unlikely(!m_index->column_offset(m_num, column, &(m_cursor[column]), &m_errtext))) {
+			return false;
+		}
+	}
+	return m_db->seekabs(m_cursor[column], &m_errtext);
+}
+
 bool PackageReader::skip() {
 	// only seek if needed
-	if(m_have != ALL) {
+	if((m_have != ALL) && !m_columns) {
 		if(unlikely(!m_db->seekabs(m_next, &m_errtext))) {
 			m_error = true;
 			return false;
@@ -111,23 +152,48 @@ Package *PackageReader::release() {
 }
 
 bool PackageReader::next() {
-	if(unlikely(m_cat_size-- == 0)) {
+	if(unlikely(m_selection != NULLPTR)) {
+		if(m_selected == m_selection->end()) {
+			return false;
+		}
+		const std::string *cat_name;
+		eix::OffsetType offset;
+		m_num = *(m_selected++);
+		if(unlikely(!m_index->locate(m_num, &cat_name, &offset, &m_errtext))) {
+			m_error = true;
+			return false;
+		}
+		m_cat_name = *cat_name;
+		if(m_columns) {
+			// The package offset is that of the name column
+			m_cursor[PackageIndex::COLUMN_NAME] = offset;
+			m_cursor_num[PackageIndex::COLUMN_NAME] = m_num;
+		} else if(unlikely(!m_db->seekabs(offset, &m_errtext))) {
+			m_error = true;
+			return false;
+		}
+	} else if(unlikely(m_cat_size-- == 0)) {
 		if(unlikely(m_frames-- == 0)) {
 			return false;
 		}
-		if(unlikely(!m_db->read_category_header(&m_cat_name, &m_cat_size, &m_errtext))) {
+		if(unlikely(!read_category_header())) {
 			m_error = true;
 			return false;
 		}
 		return next();
+	} else if(m_columns) {
+		m_num = m_count++;
 	}
 
-	eix::OffsetType len;
-	if(unlikely(!m_db->read_num(&len, &m_errtext))) {
-		m_error = true;
-		return false;
+	if(!m_columns) {
+		eix::OffsetType len;
+		if(unlikely(!m_db->read_num(&len, &m_errtext))) {
+			m_error = true;
+			return false;
+		}
+		m_next = m_db->tell() + len;
 	}
-	m_next = m_db->tell() + len;
+	Stats::count(Stats::PACKAGES_VISITED);
 	m_have = NONE;
 	delete m_pkg;
 	m_pkg = new Package;
@@ -141,26 +207,54 @@ bool PackageReader::nextCategory() {
 		return false;
 	}
 
-	if(likely(m_db->read_category_header(&m_cat_name, &m_cat_size, &m_errtext))) {
+	if(likely(read_category_header())) {
 		return true;
 	}
 	m_error = true;
 	return false;
 }
 
+/**
+In the columnar layout, the categories are taken from the index
+**/
+bool PackageReader::read_category_header() {
+	if(!m_columns) {
+		return m_db->read_category_header(&m_cat_name, &m_cat_size, &m_errtext);
+	}
+	if(m_index == NULLPTR) {
+		m_index = m_own_index = new PackageIndex(m_db);
+		if(unlikely(!m_index->init(*header))) {
+			m_db->readError(&m_errtext);
+			return false;
+		}
+	}
+	if(unlikely(m_cat == m_index->categories().size())) {
+		m_db->readError(&m_errtext);
+		return false;
+	}
+	m_cat_name = m_index->categories()[m_cat];
+	m_cat_size = m_index->category_size(m_cat++);
+	return true;
+}
+
 bool PackageReader::nextPackage() {
 	if(unlikely(m_cat_size-- == 0)) {
 		return false;
 	}
 
-	/* Ignore the offset and read the whole package at once.
-	 */
+	if(m_columns) {
+		m_num = m_count++;
+	} else {
+		/* Ignore the offset and read the whole package at once.
+		 */
 
-	eix::OffsetType dummy;
-	if(unlikely(!m_db->read_num(&dummy, &m_errtext))) {
-		m_error = true;
-		return false;
+		eix::OffsetType dummy;
+		if(unlikely(!m_db->read_num(&dummy, &m_errtext))) {
+			m_error = true;
+			return false;
+		}
 	}
+	Stats::count(Stats::PACKAGES_VISITED);
 	m_have = NONE;
 	delete m_pkg;
 	m_pkg = new Package;
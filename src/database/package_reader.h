@@ -16,8 +16,10 @@
 #include <string>
 
 #include "database/header.h"
+#include "database/package_index.h"
 #include "eixTk/eixint.h"
 #include "eixTk/null.h"
+#include "eixTk/stringtypes.h"
 
 class Database;
 class DBHeader;
@@ -40,11 +42,13 @@ class PackageReader {
 		@arg ps is used to define the local package sets while version reading
 		**/
 		PackageReader(Database *db, const DBHeader& hdr, PortageSettings *ps)
-			: m_db(db), m_frames(hdr.size), m_cat_size(0), m_pkg(NULLPTR), header(&hdr), m_portagesettings(ps), m_error(false) {
+			: m_db(db), m_frames(hdr.size), m_cat_size(0), m_pkg(NULLPTR), header(&hdr), m_portagesettings(ps), m_index(NULLPTR), m_selection(NULLPTR), m_error(false) {
+			init_columns();
 		}
 
 		PackageReader(Database *db, const DBHeader& hdr)
-			: m_db(db), m_frames(hdr.size), m_cat_size(0), m_pkg(NULLPTR), header(&hdr), m_portagesettings(NULLPTR), m_error(false) {
+			: m_db(db), m_frames(hdr.size), m_cat_size(0), m_pkg(NULLPTR), header(&hdr), m_portagesettings(NULLPTR), m_index(NULLPTR), m_selection(NULLPTR), m_error(false) {
+			init_columns();
 		}
 
 		~PackageReader();
@@ -84,6 +88,16 @@ class PackageReader {
 		**/
 		bool next();
 
+		/**
+		Let next() visit only the packages of selection (in file order).
+		The arguments must remain valid while reading.
+		**/
+		void select(PackageIndex *index, const PackageIndex::Selection *selection) ATTRIBUTE_NONNULL_ {
+			m_index = index;
+			m_selection = selection;
+			m_selected = selection->begin();
+		}
+
 		/**
 		Go into the next (or first) category part.
 		@return false if there are none more.
@@ -103,6 +117,13 @@ class PackageReader {
 			return m_cat_name;
 		}
 
+		/**
+		@return what has been read of the current package
+		**/
+		Attributes have() const {
+			return m_have;
+		}
+
 		const char *get_errtext() const {
 			return (m_error ? m_errtext.c_str() : NULLPTR);
 		}
@@ -121,8 +142,50 @@ class PackageReader {
 		const DBHeader   *header;
 		PortageSettings  *m_portagesettings;
 
+		PackageIndex     *m_index;
+		const PackageIndex::Selection *m_selection;
+		PackageIndex::Selection::const_iterator m_selected;
+
+		/**
+		For the columnar layout: the index is needed for the categories
+		and the column offsets; we own it unless select() passed one.
+		**/
+		bool              m_columns;
+		PackageIndex     *m_own_index;
+		WordVec::size_type m_cat;
+
+		/**
+		Number of the current and of the next package (in file order)
+		**/
+		eix::Treesize     m_num, m_count;
+
+		/**
+		Position behind the last read entry of each column
+		and the number of the package to which it belongs.
+		A position 0 means unknown.
+		**/
+		eix::OffsetType   m_cursor[PackageIndex::COLUMN_SIZE];
+		eix::Treesize     m_cursor_num[PackageIndex::COLUMN_SIZE];
+
 		std::string m_errtext;
 		bool m_error;
+
+		void init_columns();
+
+		/**
+		Read name and size of the next category
+		**/
+		bool read_category_header();
+
+		/**
+		Read one attribute into the current package
+		**/
+		bool read_attribute(Attributes a);
+
+		/**
+		Seek to the entry of the current package in the column of a
+		**/
+		bool seek_column(Attributes a);
 };
 
 #endif  // SRC_DATABASE_PACKAGE_READER_H_
@@ -0,0 +1,329 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#include <config.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+
+#include <string>
+
+#include "database/io.h"
+#include "database/settings_snapshot.h"
+#include "eixTk/constexpr.h"
+#include "eixTk/eixint.h"
+#include "eixTk/formated.h"
+#include "eixTk/i18n.h"
+#include "eixTk/likely.h"
+#include "eixTk/null.h"
+#include "eixTk/stringtypes.h"
+#include "eixTk/utils.h"
+#include "portage/conf/cascadingprofile.h"
+#include "portage/conf/portagesettings.h"
+#include "portage/mask_list.h"
+#include "portage/overlay.h"
+
+using std::string;
+
+/**
+The first string of a snapshot file, followed by the format version
+**/
+static const char *snapshot_magic = "eix-settings";
+static CONSTEXPR eix::UNumber snapshot_version = 1;
+
+/**
+Flags of a repository in the snapshot
+**/
+static CONSTEXPR eix::UChar
+	REPO_KNOW_PATH     = 0x01U,
+	REPO_KNOW_LABEL    = 0x02U,
+	REPO_IS_MAIN       = 0x04U,
+	REPO_NEGATIVE_PRIO = 0x08U;
+
+/**
+Flags of a file name of a PreList in the snapshot
+**/
+static CONSTEXPR eix::UChar
+	FILE_KNOW_REPO   = 0x01U,
+	FILE_HONOUR_REPO = 0x02U;
+
+PreList *SettingsSnapshot::prelist(CascadingProfile *profile, unsigned int i) {
+	switch(i) {
+		case 0:
+			return &(profile->p_system);
+		case 1:
+			return &(profile->p_profile);
+		case 2:
+			return &(profile->p_package_masks);
+		case 3:
+			return &(profile->p_package_unmasks);
+		case 4:
+			return &(profile->p_package_keywords);
+		default:
+			return &(profile->p_package_accept_keywords);
+	}
+}
+
+bool SettingsSnapshot::read_prelist(SnapshotFile *file, PreList *list) {
+	list->finalized = true;
+	PreList::FileNames::size_type names;
+	if(unlikely(!file->read_num(&names, NULLPTR))) {
+		return false;
+	}
+	for(; likely(names != 0); --names) {
+		string name, repo;
+		eix::UChar flags;
+		if(unlikely(!(file->read_string(&name, NULLPTR) &&
+			file->read_num(&flags, NULLPTR) &&
+			file->read_string(&repo, NULLPTR)))) {
+			return false;
+		}
+		list->filenames.push_back(PreListFilename(name,
+			(((flags & FILE_KNOW_REPO) != 0) ? repo.c_str() : NULLPTR),
+			((flags & FILE_HONOUR_REPO) != 0)));
+	}
+	PreList::size_type count;
+	if(unlikely(!file->read_num(&count, NULLPTR))) {
+		return false;
+	}
+	list->resize(count);
+	for(PreList::iterator it(list->begin()); likely(it != list->end()); ++it) {
+		WordVec::size_type args;
+		eix::UChar locally_double;
+		if(unlikely(!(file->read_string(&(it->name), NULLPTR) &&
+			file->read_num(&args, NULLPTR)))) {
+			return false;
+		}
+		it->args.resize(args);
+		for(WordVec::iterator arg(it->args.begin()); likely(arg != it->args.end()); ++arg) {
+			if(unlikely(!file->read_string(&(*arg), NULLPTR))) {
+				return false;
+			}
+		}
+		if(unlikely(!(file->read_num(&(it->filename_index), NULLPTR) &&
+			file->read_num(&(it->linenumber), NULLPTR) &&
+			file->read_num(&locally_double, NULLPTR)))) {
+			return false;
+		}
+		it->locally_double = (locally_double != 0);
+	}
+	return true;
+}
+
+bool SettingsSnapshot::write_prelist(SnapshotFile *file, PreList *list, string *errtext) {
+	list->finalize();
+	bool ok(file->write_num(list->filenames.size(), errtext));
+	for(PreList::FileNames::const_iterator it(list->filenames.begin());
+		likely(ok && (it != list->filenames.end())); ++it) {
+		const char *repo(it->repo());
+		eix::UChar flags(0);
+		if(repo != NULLPTR) {
+			flags |= FILE_KNOW_REPO;
+		}
+		if(it->repo_if_only() != NULLPTR) {
+			flags |= FILE_HONOUR_REPO;
+		}
+		ok = (file->write_string(it->name(), errtext) &&
+			file->write_num(flags, errtext) &&
+			file->write_string(((repo == NULLPTR) ? "" : repo), errtext));
+	}
+	ok = (ok && file->write_num(list->size(), errtext));
+	for(PreList::const_iterator it(list->begin());
+		likely(ok && (it != list->end())); ++it) {
+		ok = (file->write_string(it->name, errtext) &&
+			file->write_num(it->args.size(), errtext));
+		for(WordVec::const_iterator arg(it->args.begin());
+			likely(ok && (arg != it->args.end())); ++arg) {
+			ok = file->write_string(*arg, errtext);
+		}
+		ok = (ok && file->write_num(it->filename_index, errtext) &&
+			file->write_num(it->linenumber, errtext) &&
+			file->write_num(eix::UChar(it->locally_double ? 1 : 0), errtext));
+	}
+	return ok;
+}
+
+/**
+Everything is read into temporary objects first, so that settings is
+only modified if the whole snapshot can be used.
+**/
+bool SettingsSnapshot::read(const string& filename, const WordVec& key, PortageSettings *settings, CascadingProfile **local_profile) {
+	SnapshotFile file;
+	string magic;
+	eix::UNumber version, count;
+	if(unlikely(!(file.openread(filename.c_str()) &&
+		file.read_string(&magic, NULLPTR) &&
+		(magic == snapshot_magic) &&
+		file.read_num(&version, NULLPTR) &&
+		(version == snapshot_version) &&
+		file.read_num(&count, NULLPTR) &&
+		(count == key.size())))) {
+		return false;
+	}
+	for(WordVec::const_iterator it(key.begin()); likely(it != key.end()); ++it) {
+		string s;
+		if(unlikely(!(file.read_string(&s, NULLPTR) && (s == *it)))) {
+			return false;
+		}
+	}
+	if(unlikely(!file.read_num(&count, NULLPTR))) {
+		return false;
+	}
+	for(; likely(count != 0); --count) {
+		string name;
+		FileStamps::Stamp stored, current;
+		if(unlikely(!(file.read_string(&name, NULLPTR) &&
+			file.read_num(&(stored.mtime), NULLPTR) &&
+			file.read_num(&(stored.link), NULLPTR)))) {
+			return false;
+		}
+		FileStamps::get_stamp(name.c_str(), &current);
+		if(current != stored) {
+			return false;
+		}
+	}
+	WordMap vars;
+	if(unlikely(!file.read_num(&count, NULLPTR))) {
+		return false;
+	}
+	for(; likely(count != 0); --count) {
+		string name;
+		if(unlikely(!(file.read_string(&name, NULLPTR) &&
+			file.read_string(&(vars[name]), NULLPTR)))) {
+			return false;
+		}
+	}
+	OverlayVec repos;
+	if(unlikely(!file.read_num(&count, NULLPTR))) {
+		return false;
+	}
+	for(; likely(count != 0); --count) {
+		eix::UChar flags;
+		string path, label;
+		OverlayIdent::Priority priority;
+		if(unlikely(!(file.read_num(&flags, NULLPTR) &&
+			file.read_string(&path, NULLPTR) &&
+			file.read_string(&label, NULLPTR) &&
+			file.read_num(&priority, NULLPTR)))) {
+			return false;
+		}
+		if((flags & REPO_NEGATIVE_PRIO) != 0) {
+			priority = -priority;
+		}
+		repos.push_back(OverlayIdent(
+			(((flags & REPO_KNOW_PATH) != 0) ? path.c_str() : NULLPTR),
+			(((flags & REPO_KNOW_LABEL) != 0) ? label.c_str() : NULLPTR),
+			priority, ((flags & REPO_IS_MAIN) != 0)));
+	}
+	if(unlikely(!(file.read_num(&count, NULLPTR) &&
+		((count == 1) || (count == 2))))) {
+		return false;
+	}
+	PreList lists[2][prelist_count];
+	for(eix::UNumber p(0); likely(p != count); ++p) {
+		for(unsigned int i(0); likely(i != prelist_count); ++i) {
+			if(unlikely(!read_prelist(&file, &(lists[p][i])))) {
+				return false;
+			}
+		}
+	}
+
+	settings->swap(vars);
+	settings->repos.clear();
+	for(OverlayVec::const_iterator it(repos.begin()); likely(it != repos.end()); ++it) {
+		settings->repos.push_back(*it, false);
+	}
+	CascadingProfile *profile(settings->profile);
+	if(count == 2) {
+		*local_profile = new CascadingProfile(*profile);
+		for(unsigned int i(0); likely(i != prelist_count); ++i) {
+			*prelist(*local_profile, i) = lists[1][i];
+		}
+	}
+	for(unsigned int i(0); likely(i != prelist_count); ++i) {
+		*prelist(profile, i) = lists[0][i];
+	}
+	return true;
+}
+
+/**
+The snapshot is written into a temporary file which then replaces the
+old one, so that concurrent processes see either of them completely.
+**/
+bool SettingsSnapshot::write(const string& filename, const WordVec& key, const FileStamps& stamps, PortageSettings *settings, CascadingProfile *local_profile, string *errtext) {
+	string tmpname(eix::format("%s.%s") % filename % getpid());
+	SnapshotFile *file(new SnapshotFile);
+	if(unlikely(!file->openwrite(tmpname.c_str()))) {
+		delete file;
+		if(errtext != NULLPTR) {
+			*errtext = eix::format(_("cannot write %s")) % tmpname;
+		}
+		return false;
+	}
+	bool ok(file->write_string(snapshot_magic, errtext) &&
+		file->write_num(snapshot_version, errtext) &&
+		file->write_num(key.size(), errtext));
+	for(WordVec::const_iterator it(key.begin()); likely(ok && (it != key.end())); ++it) {
+		ok = file->write_string(*it, errtext);
+	}
+	ok = (ok && file->write_num(stamps.stamps.size(), errtext));
+	for(FileStamps::Stamps::const_iterator it(stamps.stamps.begin());
+		likely(ok && (it != stamps.stamps.end())); ++it) {
+		ok = (file->write_string(it->first, errtext) &&
+			file->write_num(it->second.mtime, errtext) &&
+			file->write_num(it->second.link, errtext));
+	}
+	ok = (ok && file->write_num(settings->size(), errtext));
+	for(PortageSettings::const_iterator it(settings->begin());
+		likely(ok && (it != settings->end())); ++it) {
+		ok = (file->write_string(it->first, errtext) &&
+			file->write_string(it->second, errtext));
+	}
+	ok = (ok && file->write_num(settings->repos.size(), errtext));
+	for(RepoList::const_iterator it(settings->repos.begin());
+		likely(ok && (it != settings->repos.end())); ++it) {
+		eix::UChar flags(0);
+		OverlayIdent::Priority priority(it->priority);
+		if(it->know_path) {
+			flags |= REPO_KNOW_PATH;
+		}
+		if(it->know_label) {
+			flags |= REPO_KNOW_LABEL;
+		}
+		if(it->is_main) {
+			flags |= REPO_IS_MAIN;
+		}
+		if(priority < 0) {
+			flags |= REPO_NEGATIVE_PRIO;
+			priority = -priority;
+		}
+		ok = (file->write_num(flags, errtext) &&
+			file->write_string(it->path, errtext) &&
+			file->write_string(it->label, errtext) &&
+			file->write_num(priority, errtext));
+	}
+	ok = (ok && file->write_num(eix::UChar((local_profile == NULLPTR) ? 1 : 2), errtext));
+	for(unsigned int i(0); likely(ok && (i != prelist_count)); ++i) {
+		ok = write_prelist(file, prelist(settings->profile, i), errtext);
+	}
+	if(local_profile != NULLPTR) {
+		for(unsigned int i(0); likely(ok && (i != prelist_count)); ++i) {
+			ok = write_prelist(file, prelist(local_profile, i), errtext);
+		}
+	}
+	ok = (ok && file->flush(errtext));
+	delete file;
+	if(likely(ok) && likely(rename(tmpname.c_str(), filename.c_str()) == 0)) {
+		return true;
+	}
+	unlink(tmpname.c_str());
+	if(ok && (errtext != NULLPTR)) {
+		*errtext = eix::format(_("cannot write %s")) % filename;
+	}
+	return false;
+}
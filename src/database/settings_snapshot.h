@@ -0,0 +1,59 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#ifndef SRC_DATABASE_SETTINGS_SNAPSHOT_H_
+#define SRC_DATABASE_SETTINGS_SNAPSHOT_H_ 1
+
+#include <string>
+
+#include "eixTk/constexpr.h"
+#include "eixTk/stringtypes.h"
+
+class CascadingProfile;
+class FileStamps;
+class PortageSettings;
+class PreList;
+class SnapshotFile;
+
+/**
+A snapshot of the settings which PortageSettings reads from make.conf,
+repos.conf, and the cascading profiles: the variables, the repositories,
+and the (not yet parsed) lines of the mask and keyword files of the
+global and local profile.
+The snapshot is used if the key (describing the settings of eixrc and
+of the environment) is unchanged and each file which was read has
+still the same modification time.
+**/
+class SettingsSnapshot {
+	public:
+		/**
+		Read the snapshot into settings; if it contains a local profile,
+		it is created from the global profile.
+		@return false if the snapshot cannot be used
+		**/
+		static bool read(const std::string& filename, const WordVec& key, PortageSettings *settings, CascadingProfile **local_profile) ATTRIBUTE_NONNULL_;
+
+		/**
+		Write the snapshot for the files recorded in stamps.
+		The PreLists of the profiles are finalized.
+		@return false if the snapshot could not be written
+		**/
+		static bool write(const std::string& filename, const WordVec& key, const FileStamps& stamps, PortageSettings *settings, CascadingProfile *local_profile, std::string *errtext) ATTRIBUTE_NONNULL((4));
+
+	private:
+		/**
+		The number of PreLists of a CascadingProfile
+		**/
+		static CONSTEXPR unsigned int prelist_count = 6;
+
+		static PreList *prelist(CascadingProfile *profile, unsigned int i) ATTRIBUTE_NONNULL_ ATTRIBUTE_CONST;
+
+		static bool read_prelist(SnapshotFile *file, PreList *list) ATTRIBUTE_NONNULL_;
+		static bool write_prelist(SnapshotFile *file, PreList *list, std::string *errtext) ATTRIBUTE_NONNULL((1, 2));
+};
+
+#endif  // SRC_DATABASE_SETTINGS_SNAPSHOT_H_
@@ -0,0 +1,395 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#include <config.h>
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <ctime>
+
+#include <map>
+#include <string>
+
+#include "database/io.h"
+#include "database/vardb_snapshot.h"
+#include "eixTk/constexpr.h"
+#include "eixTk/eixint.h"
+#include "eixTk/formated.h"
+#include "eixTk/i18n.h"
+#include "eixTk/likely.h"
+#include "eixTk/null.h"
+#include "eixTk/stats.h"
+#include "eixTk/stringtypes.h"
+#include "eixTk/sysutils.h"
+#include "eixTk/utils.h"
+
+using std::string;
+
+/**
+The first string of a snapshot file, followed by the format version
+**/
+static const char *snapshot_magic = "eix-vardb";
+static CONSTEXPR eix::UNumber snapshot_version = 1;
+
+const char *VarDbSnapshot::file_names[FILE_COUNT] = {
+	"SLOT",
+	"EAPI",
+	"IUSE",
+	"USE",
+	"RESTRICT",
+	"BUILD_TIME",
+	"repository",
+	"REPOSITORY",
+	"DEPEND",
+	"RDEPEND",
+	"PDEPEND",
+	"HDEPEND"
+};
+
+VarDbSnapshot::Entry::Entry() : know_mtime(false), mtime(0) {
+	for(eix::TinyUnsigned i(0); likely(i != FILE_COUNT); ++i) {
+		state[i] = STATE_UNKNOWN;
+	}
+}
+
+VarDbSnapshot::~VarDbSnapshot() {
+	delete m_file;
+	for(Categories::iterator it(m_categories.begin());
+		likely(it != m_categories.end()); ++it) {
+		delete it->second;
+	}
+}
+
+/**
+A snapshot file which cannot be read (e.g. of an older format)
+is silently ignored; it is replaced when the snapshot is written.
+**/
+void VarDbSnapshot::open() {
+	if(likely(m_opened)) {
+		return;
+	}
+	m_opened = true;
+	if(m_filename.empty()) {
+		return;
+	}
+	m_file = new SnapshotFile;
+	string magic;
+	eix::UNumber version, count;
+	if(unlikely(!(m_file->openread(m_filename.c_str()) &&
+		m_file->read_string(&magic, NULLPTR) &&
+		(magic == snapshot_magic) &&
+		m_file->read_num(&version, NULLPTR) &&
+		(version == snapshot_version) &&
+		m_file->read_num(&count, NULLPTR)))) {
+		delete m_file;
+		m_file = NULLPTR;
+		return;
+	}
+	for(; likely(count != 0); --count) {
+		string name;
+		Stored stored;
+		if(unlikely(!(m_file->read_string(&name, NULLPTR) &&
+			m_file->read_num(&(stored.mtime), NULLPTR) &&
+			m_file->read_num(&(stored.length), NULLPTR)))) {
+			break;
+		}
+		stored.offset = m_file->tell();
+		if(unlikely(!m_file->seekrel(stored.length, NULLPTR))) {
+			break;
+		}
+		m_stored[name] = stored;
+	}
+	if(unlikely(count != 0)) {
+		m_stored.clear();
+		delete m_file;
+		m_file = NULLPTR;
+	}
+}
+
+/**
+Each package directory is stored as its name, its modification time
+(increased by 1, or 0 if unknown), and for each file a number n:
+0 means unknown, 1 means missing, otherwise n-2 lines follow.
+**/
+bool VarDbSnapshot::read_stored(const Stored& stored, Category *category) {
+	eix::UNumber count;
+	if(unlikely(!(m_file->seekabs(stored.offset, NULLPTR) &&
+		m_file->read_num(&count, NULLPTR)))) {
+		return false;
+	}
+	for(; likely(count != 0); --count) {
+		string dir;
+		time_t mtime;
+		if(unlikely(!(m_file->read_string(&dir, NULLPTR) &&
+			m_file->read_num(&mtime, NULLPTR)))) {
+			return false;
+		}
+		Entry& entry(category->entries[dir]);
+		if(mtime != 0) {
+			entry.know_mtime = true;
+			entry.mtime = mtime - 1;
+		}
+		for(eix::TinyUnsigned i(0); likely(i != FILE_COUNT); ++i) {
+			LineVec::size_type n;
+			if(unlikely(!m_file->read_num(&n, NULLPTR))) {
+				return false;
+			}
+			if(n == 0) {
+				continue;
+			}
+			if(n == 1) {
+				entry.state[i] = STATE_MISSING;
+				continue;
+			}
+			entry.state[i] = STATE_READ;
+			LineVec& lines(entry.lines[i]);
+			lines.resize(n - 2);
+			for(LineVec::iterator it(lines.begin()); likely(it != lines.end()); ++it) {
+				if(unlikely(!m_file->read_string(&(*it), NULLPTR))) {
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+/**
+The lines of the files of a package directory are only valid as long as
+the modification time of that directory is unchanged; otherwise they are
+dropped. This notices replaced files (portage replaces them), but not
+files which are overwritten in place.
+**/
+void VarDbSnapshot::check_entry(const string& dirname, time_t now, Category *cat, Entry *entry) {
+	time_t mtime;
+	bool have_mtime(get_mtime(&mtime, dirname.c_str()));
+	if(likely(have_mtime && entry->know_mtime && (entry->mtime == mtime))) {
+		return;
+	}
+	*entry = Entry();
+	if(likely(have_mtime)) {
+		entry->know_mtime = true;
+		entry->mtime = mtime;
+		// The directory might still change in the second of its modification
+		if(unlikely(mtime >= now)) {
+			cat->store = false;
+		}
+	}
+	cat->changed = true;
+}
+
+bool VarDbSnapshot::read_category(const string& dirname, const string& category, WordVec *packages) {
+	open();
+	StoredCategories::const_iterator stored(m_stored.find(category));
+	time_t mtime;
+	if(unlikely(!get_mtime(&mtime, dirname.c_str()))) {
+		if(stored != m_stored.end()) {
+			m_dirty = true;
+		}
+		m_categories[category] = NULLPTR;
+		return false;
+	}
+	time_t now(time(NULLPTR));
+	Category *cat(new Category);
+	m_categories[category] = cat;
+	cat->mtime = mtime;
+	if((stored != m_stored.end()) && (stored->second.mtime == mtime)) {
+		if(likely(read_stored(stored->second, cat))) {
+			cat->store = true;
+			cat->changed = false;
+			for(Entries::iterator it(cat->entries.begin());
+				likely(it != cat->entries.end()); ++it) {
+				packages->push_back(it->first);
+				check_entry(dirname + "/" + it->first, now, cat, &(it->second));
+			}
+			if(cat->changed) {
+				m_dirty = true;
+			}
+			return true;
+		}
+		cat->entries.clear();
+	}
+	cat->store = (mtime < now);
+	cat->changed = true;
+	if(cat->store || (stored != m_stored.end())) {
+		m_dirty = true;
+	}
+	DIR *dir(opendir(dirname.c_str()));
+	if(dir == NULLPTR) {
+		return true;
+	}
+	struct dirent *package_entry;
+	while(likely((package_entry = readdir(dir)) != NULLPTR)) {  // NOLINT(runtime/threadsafe_fn)
+		if(package_entry->d_name[0] == '.') {
+			continue;
+		}
+		packages->push_back(package_entry->d_name);
+		check_entry(dirname + "/" + package_entry->d_name, now, cat,
+			&(cat->entries[package_entry->d_name]));
+	}
+	closedir(dir);
+	return true;
+}
+
+VarDbSnapshot::Entry *VarDbSnapshot::find_entry(const string& category, const string& dir, Category **cat) {
+	Categories::iterator c(m_categories.find(category));
+	if(unlikely((c == m_categories.end()) || (c->second == NULLPTR))) {
+		return NULLPTR;
+	}
+	Entries::iterator e(c->second->entries.find(dir));
+	if(unlikely(e == c->second->entries.end())) {
+		return NULLPTR;
+	}
+	*cat = c->second;
+	return &(e->second);
+}
+
+bool VarDbSnapshot::read_lines(const string& dirname, const string& category, const string& dir, VarDbFile file, LineVec *lines) {
+	Category *cat;
+	Entry *entry(find_entry(category, dir, &cat));
+	if(unlikely(entry == NULLPTR)) {
+		Stats::count(Stats::VARDB_FILES);
+		return pushback_lines((dirname + "/" + file_names[file]).c_str(),
+			lines, false, false, 1);
+	}
+	if(entry->state[file] == STATE_UNKNOWN) {
+		LineVec& stored(entry->lines[file]);
+		Stats::count(Stats::VARDB_FILES);
+		entry->state[file] = (pushback_lines((dirname + "/" + file_names[file]).c_str(),
+			&stored, false, false, 1) ? STATE_READ : STATE_MISSING);
+		if(cat->store) {
+			cat->changed = m_dirty = true;
+		}
+	}
+	if(entry->state[file] == STATE_MISSING) {
+		return false;
+	}
+	lines->insert(lines->end(), entry->lines[file].begin(), entry->lines[file].end());
+	return true;
+}
+
+bool VarDbSnapshot::read_mtime(const string& dirname, const string& category, const string& dir, time_t *mtime) {
+	Category *cat;
+	Entry *entry(find_entry(category, dir, &cat));
+	if(unlikely(entry == NULLPTR)) {
+		return get_mtime(mtime, dirname.c_str());
+	}
+	if(!entry->know_mtime) {
+		if(unlikely(!get_mtime(&(entry->mtime), dirname.c_str()))) {
+			return false;
+		}
+		entry->know_mtime = true;
+		if(cat->store) {
+			cat->changed = m_dirty = true;
+		}
+	}
+	*mtime = entry->mtime;
+	return true;
+}
+
+/**
+The snapshot is written into a temporary file which then replaces the
+old one, so that concurrent processes see either of them completely.
+Categories which were not needed are copied unchanged from the old file.
+**/
+bool VarDbSnapshot::write(string *errtext) {
+	if(!m_dirty || m_filename.empty()) {
+		return true;
+	}
+	string tmpname(eix::format("%s.%s") % m_filename % getpid());
+	SnapshotFile *file(new SnapshotFile);
+	if(unlikely(!file->openwrite(tmpname.c_str()))) {
+		delete file;
+		if(errtext != NULLPTR) {
+			*errtext = eix::format(_("cannot write %s")) % tmpname;
+		}
+		return false;
+	}
+	// Merge the names of the stored and of the read categories
+	std::map<string, bool> names;
+	for(StoredCategories::const_iterator it(m_stored.begin());
+		likely(it != m_stored.end()); ++it) {
+		names[it->first] = false;
+	}
+	for(Categories::const_iterator it(m_categories.begin());
+		likely(it != m_categories.end()); ++it) {
+		names[it->first] = true;
+	}
+	eix::UNumber count(0);
+	for(std::map<string, bool>::const_iterator it(names.begin());
+		likely(it != names.end()); ++it) {
+		if(it->second) {
+			const Category *cat(m_categories[it->first]);
+			if((cat == NULLPTR) || !cat->store) {
+				continue;
+			}
+		}
+		++count;
+	}
+	bool ok(file->write_string(snapshot_magic, errtext) &&
+		file->write_num(snapshot_version, errtext) &&
+		file->write_num(count, errtext));
+	for(std::map<string, bool>::const_iterator it(names.begin());
+		likely(ok && (it != names.end())); ++it) {
+		const Category *cat(it->second ? m_categories[it->first] : NULLPTR);
+		if(it->second && ((cat == NULLPTR) || !cat->store)) {
+			continue;
+		}
+		if((cat == NULLPTR) || !cat->changed) {
+			const Stored& stored(m_stored[it->first]);
+			string data;
+			ok = (file->write_string(it->first, errtext) &&
+				file->write_num(stored.mtime, errtext) &&
+				file->write_num(stored.length, errtext) &&
+				m_file->seekabs(stored.offset, errtext) &&
+				m_file->read_string_plain(&data, stored.length, errtext) &&
+				file->write_string_plain(data, errtext));
+			continue;
+		}
+		ok = (file->write_string(it->first, errtext) &&
+			file->write_num(cat->mtime, errtext));
+		string::size_type start(file->begin_length());
+		ok = (ok && file->write_num(cat->entries.size(), errtext));
+		for(Entries::const_iterator e(cat->entries.begin());
+			likely(ok && (e != cat->entries.end())); ++e) {
+			const Entry& entry(e->second);
+			ok = (file->write_string(e->first, errtext) &&
+				file->write_num(entry.know_mtime ? (entry.mtime + 1) : time_t(0), errtext));
+			for(eix::TinyUnsigned i(0); likely(ok && (i != FILE_COUNT)); ++i) {
+				switch(entry.state[i]) {
+					case STATE_UNKNOWN:
+						ok = file->write_num(eix::UNumber(0), errtext);
+						break;
+					case STATE_MISSING:
+						ok = file->write_num(eix::UNumber(1), errtext);
+						break;
+					default:
+						ok = file->write_num(entry.lines[i].size() + 2, errtext);
+						for(LineVec::const_iterator l(entry.lines[i].begin());
+							likely(ok && (l != entry.lines[i].end())); ++l) {
+							ok = file->write_string(*l, errtext);
+						}
+						break;
+				}
+			}
+		}
+		ok = (file->end_length(start, errtext) && ok);
+	}
+	ok = (ok && file->flush(errtext));
+	delete file;
+	if(likely(ok) && likely(rename(tmpname.c_str(), m_filename.c_str()) == 0)) {
+		m_dirty = false;
+		return true;
+	}
+	unlink(tmpname.c_str());
+	if(ok && (errtext != NULLPTR)) {
+		*errtext = eix::format(_("cannot write %s")) % m_filename;
+	}
+	return false;
+}
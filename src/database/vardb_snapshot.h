@@ -0,0 +1,158 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#ifndef SRC_DATABASE_VARDB_SNAPSHOT_H_
+#define SRC_DATABASE_VARDB_SNAPSHOT_H_ 1
+
+#include <ctime>
+
+#include <map>
+#include <string>
+
+#include "eixTk/eixint.h"
+#include "eixTk/null.h"
+#include "eixTk/stringtypes.h"
+
+class SnapshotFile;
+
+/**
+A snapshot of the data of the installed packages which eix reads from
+/var/db/pkg: the package directories of each category and the lines
+of the files of these directories.
+A category of the snapshot is used as long as the modification time
+of its directory has not changed; otherwise it is read again.
+Files of package directories are read from disk only once and then
+stored in the snapshot; they are read again when the modification time
+of their package directory has changed, e.g. because a file was replaced.
+Files which are overwritten in place are not noticed.
+The snapshot file is mapped when it is opened, and only the categories
+which are actually needed are decoded.
+**/
+class VarDbSnapshot {
+	public:
+		enum VarDbFile {
+			FILE_SLOT,
+			FILE_EAPI,
+			FILE_IUSE,
+			FILE_USE,
+			FILE_RESTRICT,
+			FILE_BUILD_TIME,
+			FILE_REPOSITORY,
+			FILE_REPOSITORY_UPPER,
+			FILE_DEPEND,
+			FILE_RDEPEND,
+			FILE_PDEPEND,
+			FILE_HDEPEND,
+			FILE_COUNT
+		};
+
+		/**
+		The names of the files in the package directories
+		**/
+		static const char *file_names[FILE_COUNT];
+
+		explicit VarDbSnapshot(const std::string& filename) : m_filename(filename), m_file(NULLPTR), m_opened(false), m_dirty(false) {
+		}
+
+		~VarDbSnapshot();
+
+		/**
+		Read the names of the package directories of category in dirname
+		@return false if there is no such category
+		**/
+		bool read_category(const std::string& dirname, const std::string& category, WordVec *packages) ATTRIBUTE_NONNULL_;
+
+		/**
+		Read the lines of a file of the package directory dir of category
+		in dirname (which is the path of that package directory)
+		@return false if the file cannot be read
+		**/
+		bool read_lines(const std::string& dirname, const std::string& category, const std::string& dir, VarDbFile file, LineVec *lines) ATTRIBUTE_NONNULL_;
+
+		/**
+		Read the modification time of the package directory dir of category
+		**/
+		bool read_mtime(const std::string& dirname, const std::string& category, const std::string& dir, time_t *mtime) ATTRIBUTE_NONNULL_;
+
+		/**
+		Write the snapshot if something has changed
+		@return false if the snapshot could not be written
+		**/
+		bool write(std::string *errtext);
+
+	private:
+		/**
+		The states of a file of a package directory
+		**/
+		enum FileState {
+			STATE_UNKNOWN,
+			STATE_MISSING,
+			STATE_READ
+		};
+
+		class Entry {
+			public:
+				FileState state[FILE_COUNT];
+				LineVec lines[FILE_COUNT];
+				bool know_mtime;
+				time_t mtime;
+
+				Entry();
+		};
+
+		typedef std::map<std::string, Entry> Entries;
+
+		class Category {
+			public:
+				time_t mtime;
+
+				/**
+				store: The category can be stored; this is not the case
+				if it might change in the second of its modification time.
+				changed: The category differs from that in the snapshot file.
+				**/
+				bool store, changed;
+
+				Entries entries;
+		};
+
+		typedef std::map<std::string, Category *> Categories;
+
+		/**
+		A category in the snapshot file which is not yet decoded
+		**/
+		class Stored {
+			public:
+				time_t mtime;
+				eix::OffsetType offset, length;
+		};
+
+		typedef std::map<std::string, Stored> StoredCategories;
+
+		std::string m_filename;
+		SnapshotFile *m_file;
+		bool m_opened, m_dirty;
+		StoredCategories m_stored;
+		Categories m_categories;
+
+		/**
+		Open the snapshot file (if not done yet) and read its index
+		**/
+		void open();
+
+		bool read_stored(const Stored& stored, Category *category) ATTRIBUTE_NONNULL_;
+
+		/**
+		Drop the stored data of the package directory dirname if that
+		directory has changed
+		**/
+		void check_entry(const std::string& dirname, time_t now, Category *cat, Entry *entry) ATTRIBUTE_NONNULL_;
+
+		Entry *find_entry(const std::string& category, const std::string& dir, Category **cat);
+};
+
+#endif  // SRC_DATABASE_VARDB_SNAPSHOT_H_
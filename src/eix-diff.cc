@@ -28,6 +28,7 @@
 #include "eixTk/i18n.h"
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
+#include "eixTk/stats.h"
 #include "eixTk/utils.h"
 #include "eixrc/eixrc.h"
 #include "eixrc/global.h"
@@ -80,6 +81,7 @@ static void print_help() {
 "     --dump-defaults     dump default values of variables\n"
 "     --print             print the expanded value of a variable\n"
 "     --known-vars        print all variable names known to --print\n"
+"     --stats             print times and counters to stderr at exit\n"
 "\n"
 " -h, --help              show a short help screen\n"
 " -V, --version           show version-string\n"
@@ -94,6 +96,7 @@ bool cli_show_help(false),
 	cli_dump_defaults(false),
 	cli_known_vars(false),
 	cli_ansi(false),
+	cli_stats(false),
 	cli_quick,
 	cli_care,
 	cli_deps_installed,
@@ -109,7 +112,8 @@ enum cli_options {
 	O_CARE,
 	O_DEPS_INSTALLED,
 	O_ANSI,
-	O_FORCE_COLOR
+	O_FORCE_COLOR,
+	O_STATS
 };
 
 
@@ -135,6 +139,7 @@ EixDiffOptionList::EixDiffOptionList() {
 	push_back(Option("deps_installed", O_DEPS_INSTALLED, Option::BOOLEAN_T, &cli_deps_installed));
 	push_back(Option("quiet",        'q',    Option::BOOLEAN,   &cli_quiet));
 	push_back(Option("ansi",         O_ANSI, Option::BOOLEAN_T, &cli_ansi));
+	push_back(Option("stats",        O_STATS, Option::BOOLEAN_T, &cli_stats));
 }
 
 static void load_db(const char *file, DBHeader *header, PackageTree *body, PortageSettings *ps) {
@@ -277,6 +282,8 @@ static void parseFormat(Node **format, const char *varname, EixRc *rc) {
 }
 
 int run_eix_diff(int argc, char *argv[]) {
+	Stats::init("eix-diff");
+
 	// Initialize static classes
 	Eapi::init_static();
 	ExtendedVersion::init_static();
@@ -311,6 +318,7 @@ int run_eix_diff(int argc, char *argv[]) {
 	/* Setup ArgumentReader. */
 	ArgumentReader argreader(argc, argv, EixDiffOptionList());
 	ArgumentReader::iterator current_param(argreader.begin());
+	Stats::startup_done(cli_stats);
 
 	if(unlikely(cli_ansi)) {
 		AnsiColor::AnsiPalette();
@@ -373,7 +381,9 @@ int run_eix_diff(int argc, char *argv[]) {
 	parseFormat(&format_delete, "DIFF_FORMAT_DELETE", &rc);
 	parseFormat(&format_changed, "DIFF_FORMAT_CHANGED", &rc);
 
+	StatsTimer settings_timer(Stats::PHASE_SETTINGS);
 	portagesettings = new PortageSettings(&rc, true, false);
+	settings_timer.finish();
 
 	varpkg_db = new VarDbPkg(rc["EPREFIX_INSTALLED"] + VAR_DB_PKG,
 		!cli_quick, cli_care, cli_deps_installed,
@@ -387,6 +397,7 @@ int run_eix_diff(int argc, char *argv[]) {
 	set_stability_new = new SetStability(portagesettings, local_settings, false, always_accept_keywords);
 	format_for_new->recommend_mode = rc.getLocalMode("RECOMMEND_LOCAL_MODE");
 
+	StatsTimer read_timer(Stats::PHASE_READ);
 	PackageTree new_tree;
 	new_header = new DBHeader;
 	load_db(new_file.c_str(), new_header, &new_tree, portagesettings);
@@ -396,6 +407,7 @@ int run_eix_diff(int argc, char *argv[]) {
 	old_header = new DBHeader;
 	load_db(old_file.c_str(), old_header, &old_tree, portagesettings);
 	set_stability_old->set_stability(&old_tree);
+	read_timer.finish();
 
 	format_for_new->set_overlay_translations(NULLPTR);
 
@@ -423,8 +435,10 @@ int run_eix_diff(int argc, char *argv[]) {
 	differ.found_package   = print_found_package;
 	differ.changed_package = print_changed_package;
 
+	StatsTimer print_timer(Stats::PHASE_PRINT);
 	differ.diff(&old_tree, &new_tree);
 	cout << format_for_new->color_end;
+	print_timer.finish();
 
 	delete varpkg_db;
 	delete portagesettings;
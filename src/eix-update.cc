@@ -10,11 +10,16 @@
 #include <config.h>
 
 #include <fnmatch.h>
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <cstdio>
 #include <cstdlib>
 
+#include <algorithm>
 #include <iostream>
 #include <list>
 #include <string>
@@ -23,13 +28,18 @@
 #include "cache/cachetable.h"
 #include "database/header.h"
 #include "database/io.h"
+#include "database/package_index.h"
+#include "database/package_reader.h"
 #include "eixTk/argsreader.h"
+#include "eixTk/eixint.h"
 #include "eixTk/filenames.h"
 #include "eixTk/formated.h"
 #include "eixTk/i18n.h"
 #include "eixTk/likely.h"
+#include "eixTk/mutex.h"
 #include "eixTk/null.h"
 #include "eixTk/percentage.h"
+#include "eixTk/stats.h"
 #include "eixTk/statusline.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/stringutils.h"
@@ -41,10 +51,12 @@
 #include "portage/conf/portagesettings.h"
 #include "portage/depend.h"
 #include "portage/extendedversion.h"
+#include "portage/package.h"
 #include "portage/overlay.h"
 #include "portage/packagetree.h"
 #include "various/drop_permissions.h"
 
+using std::count;
 using std::list;
 using std::string;
 using std::vector;
@@ -107,6 +119,10 @@ typedef vector<RepoName> RepoNames;
 
 static void print_help();
 static bool update(const char *outputfile, CacheTable *cache_table, PortageSettings *portage_settings, bool override_umask, const RepoNames& repo_names, const WordVec& exclude_labels, Statusline *statusline, string *errtext) ATTRIBUTE_NONNULL_;
+static void calc_fingerprints(DBHeader *dbheader, CacheTable *cache_table, const PackageTree& package_tree) ATTRIBUTE_NONNULL_;
+static eix::Catsize reuse_categories(const char *outputfile, const DBHeader& dbheader, PackageTree *package_tree, vector<bool> *reused) ATTRIBUTE_NONNULL_;
+static void read_categories(BasicCache *cache, PackageTree *package_tree, const vector<bool>& reused, bool *is_empty, bool *aborted) ATTRIBUTE_NONNULL_;
+static void *read_categories_job(void *arg) ATTRIBUTE_NONNULL_;
 static void error_callback(const string& str);
 static void add_pathnames(PathVec *add_list, const WordVec& to_add, bool must_resolve) ATTRIBUTE_NONNULL_;
 static void add_override(Overrides *override_list, EixRc *eixrc, const char *s) ATTRIBUTE_NONNULL_;
@@ -129,6 +145,8 @@ static void print_help() {
 "     --force-status      always output status line\n"
 " -F, --force-color       force \"color\" even if output is no terminal\n"
 " -v, --verbose           output used cache method for each ebuild\n"
+" -j, --jobs N            read the categories with N threads (0: one per CPU)\n"
+"     --stats             print times and counters to stderr at exit\n"
 "\n"
 " -q, --quiet             produce no output\n"
 "\n"
@@ -153,7 +171,8 @@ enum cli_options {
 	O_DUMP_DEFAULTS,
 	O_KNOWN_VARS,
 	O_PRINT_VAR,
-	O_FORCE_STATUS
+	O_FORCE_STATUS,
+	O_STATS
 };
 
 static bool
@@ -162,7 +181,8 @@ static bool
 	show_version(false),
 	known_vars(false),
 	dump_eixrc(false),
-	dump_defaults(false);
+	dump_defaults(false),
+	print_stats(false);
 
 static bool use_percentage, use_status, verbose;
 
@@ -178,6 +198,17 @@ static RepoArgs *repo_args;
 
 static const char *outputname = NULLPTR;
 static const char *var_to_print = NULLPTR;
+static const char *jobs_arg = NULLPTR;
+
+/**
+Number of threads for reading the categories
+**/
+static unsigned int update_jobs;
+
+/**
+Whether categories are reused from the previous database if unchanged
+**/
+static bool update_incremental;
 
 /**
 Arguments and options
@@ -200,6 +231,8 @@ EixUpdateOptionList::EixUpdateOptionList() {
 	push_back(Option("force-color",    'F',     Option::BOOLEAN_T,  &use_percentage));
 	push_back(Option("force-status", O_FORCE_STATUS, Option::BOOLEAN_T, &use_status));
 	push_back(Option("verbose",        'v',     Option::BOOLEAN_T,  &verbose));
+	push_back(Option("jobs",           'j',     Option::STRING,     &jobs_arg));
+	push_back(Option("stats",        O_STATS,   Option::BOOLEAN_T,  &print_stats));
 
 	push_back(Option("exclude-overlay", 'x',    Option::STRINGLIST, exclude_args));
 	push_back(Option("add-overlay",    'a',     Option::STRINGLIST, add_args));
@@ -210,6 +243,29 @@ EixUpdateOptionList::EixUpdateOptionList() {
 
 static PercentStatus *reading_percent_status;
 
+/**
+Serializes the output and the access to ReadQueue
+when categories are read in parallel
+**/
+static eix::Mutex *update_mutex;
+
+/**
+The categories which are still to be read by read_categories_job()
+**/
+class ReadQueue {
+	public:
+		PackageTree::iterator next, end;
+		vector<bool>::size_type index;
+		const vector<bool> *reused;
+		bool is_empty, aborted;
+};
+
+class ReadJob {
+	public:
+		BasicCache *cache;
+		ReadQueue *queue;
+};
+
 
 static void add_pathnames(PathVec *add_list, const WordVec& to_add, bool must_resolve) {
 	for(WordVec::const_iterator it(to_add.begin());
@@ -293,10 +349,13 @@ static bool stringstart_in_wordlist(const string& to_check, const WordVec& wordl
 }
 
 int run_eix_update(int argc, char *argv[]) {
+	Stats::init("eix-update");
+
 	// Initialize static classes
 	Eapi::init_static();
 	ExtendedVersion::init_static();
 	PortageSettings::init_static();
+	update_mutex = new eix::Mutex;
 	exclude_args = new ExcludeArgs;
 	add_args = new AddArgs;
 	method_args = new MethodArgs;
@@ -315,6 +374,8 @@ int run_eix_update(int argc, char *argv[]) {
 	}
 	Depend::use_depend = eixrc.getBool("DEP");
 	Version::use_required_use = eixrc.getBool("REQUIRED_USE");
+	PackageIndex::use_trigrams = eixrc.getBool("TRIGRAMS");
+	PackageIndex::use_columns = eixrc.getBool("COLUMNAR");
 	string eix_cachefile(eixrc["EIX_CACHEFILE"]); {
 	/* calculate defaults for use_{percentage,status} */
 		bool percentage_tty(false);
@@ -348,9 +409,12 @@ int run_eix_update(int argc, char *argv[]) {
 
 	/* other defaults */
 	verbose = eixrc.getBool("UPDATE_VERBOSE");
+	update_jobs = eixrc.getInteger("UPDATE_JOBS");
+	update_incremental = eixrc.getBool("UPDATE_INCREMENTAL");
 
 	/* Setup ArgumentReader. */
 	ArgumentReader argreader(argc, argv, EixUpdateOptionList());
+	Stats::startup_done(print_stats);
 
 	/* We do not want any arguments except options */
 	if(unlikely(argreader.begin() != argreader.end())) {
@@ -381,6 +445,13 @@ int run_eix_update(int argc, char *argv[]) {
 		return EXIT_SUCCESS;
 	}
 
+	if(unlikely(jobs_arg != NULLPTR)) {
+		update_jobs = my_atoi(jobs_arg);
+	}
+	if(update_jobs == 0) {
+		update_jobs = get_processors();
+	}
+
 	/* Honour a wish for silence */
 	if(unlikely(quiet)) {
 		if(!freopen(DEV_NULL, "w", stdout)) {
@@ -403,7 +474,9 @@ int run_eix_update(int argc, char *argv[]) {
 		program_name, eixrc["EXIT_STATUSLINE"]);
 
 	INFO(_("Reading Portage settings...\n"));
+	StatsTimer settings_timer(Stats::PHASE_SETTINGS);
 	PortageSettings portage_settings(&eixrc, false, true);
+	settings_timer.finish();
 
 	/* Build default (overlay/method/...) lists, using environment vars */
 	Overrides override_list;
@@ -556,11 +629,233 @@ int run_eix_update(int argc, char *argv[]) {
 }
 
 static void error_callback(const string& str) {
+	eix::MutexLocker locker(update_mutex);
 	reading_percent_status->interprint_start();
 	cerr << str << endl;
 	reading_percent_status->interprint_end();
 }
 
+/**
+Read categories from the queue until it is empty
+**/
+static void *read_categories_job(void *arg) {
+	ReadJob *job(static_cast<ReadJob *>(arg));
+	BasicCache *cache(job->cache);
+	ReadQueue *queue(job->queue);
+	for(;;) {
+		PackageTree::iterator ci;
+		bool reused;
+		{
+			eix::MutexLocker locker(update_mutex);
+			if(queue->next == queue->end) {
+				break;
+			}
+			ci = queue->next++;
+			reused = (*(queue->reused))[queue->index++];
+		}
+		bool prepared(true), ok(true);
+		if(likely(!reused)) {
+			prepared = cache->readCategoryPrepare(ci->first.c_str());
+			ok = ((!prepared) || cache->readCategory(ci->second));
+			cache->readCategoryFinalize();
+		}
+		eix::MutexLocker locker(update_mutex);
+		if(prepared) {
+			queue->is_empty = false;
+			if(use_percentage) {
+				reading_percent_status->next(eix::format(P_("Percent", ": %s...")) % ci->first);
+			}
+		} else if(use_percentage) {
+			reading_percent_status->next();
+		}
+		if(unlikely(!ok)) {
+			queue->aborted = true;
+		}
+	}
+	return NULLPTR;
+}
+
+/**
+Read all categories of package_tree from cache which are not reused.
+Each category is read by only one thread into its own Category object,
+so that the result does not depend on the number of threads.
+**/
+static void read_categories(BasicCache *cache, PackageTree *package_tree, const vector<bool>& reused, bool *is_empty, bool *aborted) {
+	ReadQueue queue;
+	queue.next = package_tree->begin();
+	queue.end = package_tree->end();
+	queue.index = 0;
+	queue.reused = &reused;
+	queue.is_empty = true;
+	queue.aborted = false;
+	vector<ReadJob> jobs(1);
+	jobs[0].cache = cache;
+	jobs[0].queue = &queue;
+#ifdef HAVE_PTHREAD_H
+	vector<pthread_t> threads;
+	if(update_jobs > 1) {
+		for(unsigned int i(1); likely(i < update_jobs); ++i) {
+			BasicCache *c(cache->clone());
+			if(c == NULLPTR) {
+				break;
+			}
+			ReadJob job;
+			job.cache = c;
+			job.queue = &queue;
+			jobs.push_back(job);
+		}
+		threads.resize(jobs.size());
+		vector<ReadJob>::size_type started(1);
+		for(; likely(started != jobs.size()); ++started) {
+			if(unlikely(pthread_create(&(threads[started]), NULLPTR, read_categories_job, &(jobs[started])) != 0)) {
+				break;
+			}
+		}
+		threads.resize(started);
+	}
+#endif
+	read_categories_job(&(jobs[0]));
+#ifdef HAVE_PTHREAD_H
+	for(vector<pthread_t>::size_type i(1); i < threads.size(); ++i) {
+		pthread_join(threads[i], NULLPTR);
+	}
+	for(vector<ReadJob>::size_type i(1); i < jobs.size(); ++i) {
+		delete jobs[i].cache;
+	}
+#endif
+	*is_empty = queue.is_empty;
+	*aborted = queue.aborted;
+}
+
+/**
+Store for each overlay whose cache supports it the fingerprints of
+all categories of package_tree
+**/
+static void calc_fingerprints(DBHeader *dbheader, CacheTable *cache_table, const PackageTree& package_tree) {
+	dbheader->fingerprint_methods.assign(dbheader->countOverlays(), string());
+	dbheader->fingerprints.assign(dbheader->countOverlays(), vector<eix::UNumber>());
+	for(CacheTable::iterator it(cache_table->begin());
+		likely(it != cache_table->end()); ++it) {
+		BasicCache *cache(*it);
+		if(cache->can_read_multiple_categories()) {
+			continue;
+		}
+		vector<eix::UNumber> fingerprints;
+		fingerprints.reserve(package_tree.size());
+		bool ok(true);
+		for(PackageTree::const_iterator c(package_tree.begin());
+			likely(c != package_tree.end()); ++c) {
+			eix::UNumber fingerprint;
+			cache->readCategoryPrepare(c->first.c_str());
+			ok = cache->get_fingerprint(&fingerprint);
+			cache->readCategoryFinalize();
+			if(!ok) {
+				break;
+			}
+			fingerprints.push_back(fingerprint);
+		}
+		if(ok) {
+			ExtendedVersion::Overlay key(cache->getKey());
+			dbheader->fingerprint_methods[key] = cache->getType();
+			dbheader->fingerprints[key].swap(fingerprints);
+		}
+	}
+}
+
+/**
+Read those categories from the previous database whose fingerprints
+are unchanged for all overlays. Nothing is reused if the settings or
+overlays have changed or if an error occurs.
+@return the number of reused categories
+**/
+static eix::Catsize reuse_categories(const char *outputfile, const DBHeader& dbheader, PackageTree *package_tree, vector<bool> *reused) {
+	reused->assign(package_tree->size(), false);
+	Database db;
+	if(!db.openread(outputfile)) {
+		return 0;
+	}
+	DBHeader header;
+	if(!db.read_header(&header, NULLPTR)) {
+		return 0;
+	}
+	if((header.use_depend != Depend::use_depend) ||
+		(header.use_required_use != Version::use_required_use) ||
+		(header.countOverlays() != dbheader.countOverlays())) {
+		return 0;
+	}
+	for(ExtendedVersion::Overlay i(0); likely(i != header.countOverlays()); ++i) {
+		const OverlayIdent& old_overlay(header.getOverlay(i));
+		const OverlayIdent& overlay(dbheader.getOverlay(i));
+		if((old_overlay.path != overlay.path) || (old_overlay.label != overlay.label) ||
+			dbheader.fingerprint_methods[i].empty()) {
+			return 0;
+		}
+	}
+	PackageIndex index(&db);
+	WordVec methods;
+	vector<vector<eix::UNumber> > fingerprints;
+	if(!(index.init(header) && index.read_fingerprints(&methods, &fingerprints))) {
+		return 0;
+	}
+	if(methods != dbheader.fingerprint_methods) {
+		return 0;
+	}
+
+	// Both lists of categories are sorted
+	const WordVec& categories(index.categories());
+	PackageIndex::Selection sel;
+	WordVec::size_type c(0), i(0);
+	for(PackageTree::const_iterator it(package_tree->begin());
+		likely(it != package_tree->end()); ++it, ++i) {
+		while((c != categories.size()) && (categories[c] < it->first)) {
+			++c;
+		}
+		if((c == categories.size()) || (categories[c] != it->first)) {
+			continue;
+		}
+		bool unchanged(true);
+		for(vector<vector<eix::UNumber> >::size_type k(0); likely(k != fingerprints.size()); ++k) {
+			if(fingerprints[k][c] != dbheader.fingerprints[k][i]) {
+				unchanged = false;
+				break;
+			}
+		}
+		if(unchanged) {
+			(*reused)[i] = true;
+			index.select_category(&sel, it->first, true);
+		}
+	}
+	if(sel.empty()) {
+		// Either nothing is reused or only empty categories
+		return count(reused->begin(), reused->end(), true);
+	}
+
+	PackageReader reader(&db, header);
+	reader.select(&index, &sel);
+	eix::Treesize read(0);
+	while(reader.next()) {
+		Package *p(reader.release());
+		if(unlikely(p == NULLPTR)) {
+			break;
+		}
+		for(Package::iterator v(p->begin()); likely(v != p->end()); ++v) {
+			v->maskflags.set(MaskFlags::MASK_NONE);
+		}
+		(*package_tree)[p->category].addPackage(p);
+		++read;
+	}
+	if(likely(read == sel.size())) {
+		return count(reused->begin(), reused->end(), true);
+	}
+	// Undo everything on errors
+	for(PackageTree::iterator it(package_tree->begin());
+		likely(it != package_tree->end()); ++it) {
+		it->second->delete_and_clear();
+	}
+	reused->assign(package_tree->size(), false);
+	return 0;
+}
+
 static bool update(const char *outputfile, CacheTable *cache_table, PortageSettings *portage_settings, bool override_umask, const RepoNames& repo_names, const WordVec& exclude_labels, Statusline *statusline, string *errtext) {
 	DBHeader dbheader;
 	WordVec categories;
@@ -600,10 +895,30 @@ static bool update(const char *outputfile, CacheTable *cache_table, PortageSetti
 		++it;
 	}
 
-	/* Build database from scratch. */
+	vector<bool> reused(package_tree.size(), false);
+	calc_fingerprints(&dbheader, cache_table, package_tree);
+	if(update_incremental) {
+		StatsTimer timer(Stats::PHASE_READ);
+		eix::Catsize count_reused(reuse_categories(outputfile, dbheader, &package_tree, &reused));
+		if(count_reused != 0) {
+			INFO(eix::format(N_(
+				"Reusing %s unchanged category from %s\n",
+				"Reusing %s unchanged categories from %s\n",
+				count_reused))
+				% count_reused % outputfile);
+		}
+	}
+
+	/* Read the remaining categories from the caches. */
+	StatsTimer cache_timer(Stats::PHASE_CACHE);
 	for(CacheTable::iterator it(cache_table->begin());
 		likely(it != cache_table->end()); ++it) {
 		BasicCache *cache(*it);
+		eix::UNumber cache_files(Stats::counter(Stats::CACHE_FILES));
+		double wall, cpu;
+		if(unlikely(Stats::enabled)) {
+			Stats::now(&wall, &cpu);
+		}
 		INFO(eix::format(_("[%s] \"%s\" %s (cache: %s)\n"))
 			% cache->getKey()
 			% cache->getOverlayName()
@@ -634,26 +949,8 @@ static bool update(const char *outputfile, CacheTable *cache_table, PortageSetti
 					% package_tree.size());
 			}
 
-			/* iterator through categories */
-			bool aborted(false);
-			bool is_empty(true);
-			for(PackageTree::const_iterator ci(package_tree.begin());
-				unlikely(ci != package_tree.end()); ++ci) {
-				if(!cache->readCategoryPrepare(ci->first.c_str())) {
-					if(use_percentage) {
-						reading_percent_status->next();
-					}
-				} else {
-					if(use_percentage) {
-						reading_percent_status->next(eix::format(P_("Percent", ": %s...")) % ci->first);
-					}
-					is_empty = false;
-					if(!cache->readCategory(ci->second)) {
-						aborted = true;
-					}
-				}
-				cache->readCategoryFinalize();
-			}
+			bool aborted, is_empty;
+			read_categories(cache, &package_tree, reused, &is_empty, &aborted);
 			string msg(unlikely(is_empty) ? P_("Percent", "EMPTY!") :
 				(unlikely(aborted) ? P_("Percent", "ABORTED!") :
 					P_("Percent", "Finished")));
@@ -663,11 +960,20 @@ static bool update(const char *outputfile, CacheTable *cache_table, PortageSetti
 			reading_percent_status->finish(msg);
 		}
 		delete reading_percent_status;
+		if(unlikely(Stats::enabled)) {
+			double end_wall, end_cpu;
+			Stats::now(&end_wall, &end_cpu);
+			Stats::add_repo(cache->getOverlayName(),
+				Stats::counter(Stats::CACHE_FILES) - cache_files,
+				end_wall - wall, end_cpu - cpu);
+		}
 	}
+	cache_timer.finish();
 	statusline->print(P_("Statusline eix-update", "Analyzing"));
 
 	/* Now apply all masks... */
 	INFO(_("Applying masks...\n"));
+	StatsTimer masks_timer(Stats::PHASE_MASKS);
 	for(PackageTree::iterator c(package_tree.begin());
 		likely(c != package_tree.end()); ++c) {
 		Category *ci = c->second;
@@ -678,30 +984,46 @@ static bool update(const char *outputfile, CacheTable *cache_table, PortageSetti
 		}
 	}
 
+	masks_timer.finish();
+
 	INFO(_("Calculating hash tables...\n"));
+	StatsTimer write_timer(Stats::PHASE_WRITE);
 	Database::prep_header_hashs(&dbheader, package_tree);
 
 	/* And write database back to disk... */
 	statusline->print(eix::format(P_("Statusline eix-update", "Creating %s")) % outputfile);
 	INFO(eix::format(_("Writing database file %s...\n")) % outputfile);
+	// The database is written into a temporary file which then replaces
+	// the old one: Running eix processes may have mapped the old file,
+	// and truncating it would make them crash.
+	string tmpname(eix::format("%s.%s") % outputfile % getpid());
 	mode_t old_umask;
 	if(override_umask) {
 		old_umask = umask(2);
 	}
-	Database db;
-	bool ok(db.openwrite(outputfile));
+	Database *db(new Database);
+	bool ok(db->openwrite(tmpname.c_str()));
 	if(override_umask) {
 		umask(old_umask);
 	}
 	if(unlikely(!ok)) {
-		*errtext = eix::format(_("cannot open database file %s for writing (mode = 'wb')")) % outputfile;
+		delete db;
+		*errtext = eix::format(_("cannot open database file %s for writing (mode = 'wb')")) % tmpname;
 		return false;
 	}
 
 	dbheader.size = package_tree.countCategories();
 
-	if(!(likely(db.write_header(dbheader, errtext)) &&
-		likely(db.write_packagetree(package_tree, dbheader, errtext)))) {
+	ok = (likely(db->write_header(dbheader, errtext)) &&
+		likely(db->write_packagetree(package_tree, dbheader, errtext)) &&
+		likely(db->flush(errtext)));
+	delete db;
+	if(likely(ok) && unlikely(rename(tmpname.c_str(), outputfile) != 0)) {
+		*errtext = eix::format(_("cannot rename %s to %s")) % tmpname % outputfile;
+		ok = false;
+	}
+	if(unlikely(!ok)) {
+		unlink(tmpname.c_str());
 		return false;
 	}
 
@@ -9,16 +9,23 @@
 
 #include <config.h>
 
+#include <sys/types.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
 
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "database/header.h"
+#include "database/package_index.h"
 #include "database/package_reader.h"
 #include "eixTk/ansicolor.h"
 #include "eixTk/argsreader.h"
@@ -32,8 +39,10 @@
 #include "eixTk/null.h"
 #include "eixTk/outputstring.h"
 #include "eixTk/ptr_list.h"
+#include "eixTk/stats.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/stringutils.h"
+#include "eixTk/sysutils.h"
 #include "eixTk/utils.h"
 #include "eixrc/eixrc.h"
 #include "eixrc/global.h"
@@ -58,10 +67,16 @@
 
 #define VAR_DB_PKG "/var/db/pkg/"
 
+/**
+With --jobs, each process matches at least that many packages
+**/
+#define SEARCH_JOBS_MIN_PACKAGES 128
+
 template<typename m_Type> class MaskList;
 
 using std::map;
 using std::string;
+using std::vector;
 
 using std::cerr;
 using std::cout;
@@ -77,6 +92,15 @@ static bool is_current_dbversion(const char *filename, const char *tooltext) ATT
 static void print_wordvec(const WordVec& vec);
 static void print_unused(const string& filename, const string& excludefiles, const eix::ptr_list<Package>& packagelist, bool test_empty);
 static void print_removed(const string& dirname, const string& excludefiles, const eix::ptr_list<Package>& packagelist);
+static bool match_packages(Database *db, const DBHeader& header, PortageSettings *portagesettings, PackageIndex *index, MatchTree *matchtree, const PackageIndex::Selection& candidates, PackageIndex::Selection *matches) ATTRIBUTE_NONNULL((1, 3, 4, 5, 7));
+static bool write_all(int fd, const char *data, string::size_type len) ATTRIBUTE_NONNULL_;
+static bool read_all(int fd, string *data) ATTRIBUTE_NONNULL_;
+static bool parallel_select(Database *db, const DBHeader& header, PortageSettings *portagesettings, PackageIndex *index, MatchTree *matchtree, unsigned int jobs, bool selected, PackageIndex::Selection *sel) ATTRIBUTE_NONNULL((1, 3, 4, 5, 8));
+static bool print_rdepends(Database *db, const DBHeader& header, PortageSettings *portagesettings, const string& name) ATTRIBUTE_NONNULL((1, 3));
+static Option::Type keep_type(Option::Type type) ATTRIBUTE_CONST;
+static bool run_batch(const char *filename, Database *db, DBHeader *header, PortageSettings *portagesettings, VarDbPkg *varpkg_db, SetStability *stability, EixRc *eixrc, bool only_printed, bool is_tty, eix::ptr_list<Package>::size_type *count) ATTRIBUTE_NONNULL_;
+static eix::ptr_list<Package>::size_type print_matches(eix::ptr_list<Package> *matches, DBHeader *header, VarDbPkg *varpkg_db, PortageSettings *portagesettings, SetStability *stability, EixRc *eixrc, MaskList<Mask> *marked_list, bool only_printed, bool is_tty) ATTRIBUTE_NONNULL((1, 2, 3, 4, 5, 6));
+static int match_status(EixRc *eixrc, eix::ptr_list<Package>::size_type count) ATTRIBUTE_NONNULL_;
 inline static void print_unused(const string& filename, const string& excludefiles, const eix::ptr_list<Package>& packagelist);
 inline static void print_unused(const string& filename, const string& excludefiles, const eix::ptr_list<Package>& packagelist) {
 	print_unused(filename, excludefiles, packagelist, false);
@@ -114,6 +138,8 @@ static void dump_help() {
 "     --print-all-licenses  print all LICENSE strings used in some package\n"
 "     --print-all-depends   print all words occurring in some {,R,P}DEPEND\n"
 "                           (needs DEP=true)\n"
+"     --rdeps CAT/PKG       print the versions depending on CAT/PKG and the\n"
+"                           kinds of dependencies (needs DEP=true)\n"
 "     --print-world-sets    print the world sets\n"
 "     --print-profile-paths print all paths of current profile\n"
 "     --256                 Print all ansi color palettes\n"
@@ -134,6 +160,13 @@ static void dump_help() {
 "         --care            always read slots of installed packages\n"
 "         --deps-installed  always read deps of installed packages\n"
 "         --cache-file      use another cache-file instead of %s\n"
+"         --jobs N          match the packages with N processes\n"
+"         --batch FILE      match the queries of the lines of FILE in one pass\n"
+"                           over the database; output is grouped by query\n"
+"         --stats           print times and counters to stderr at exit\n"
+"         --explain         print the match tree with the number of packages which\n"
+"                           reached and passed each node and the time spent\n"
+"                           inside to stderr; this implies --jobs 1\n"
 "     -R  --remote (toggle)  use remote cache-file %s\n"
 "     -Z  --remote2 (toggle) use remote cache-file %s\n"
 "\n"
@@ -147,6 +180,8 @@ static void dump_help() {
 "     -0  --brief (toggle)   Print at most one package then stop. See -q\n"
 "                            Usually faster with COUNT_ONLY_PRINTED=false\n"
 "         --brief2 (toggle)  Print at most two packages then stop\n"
+"         --fuzzy-top N      Print only the N (> 0) matches with the smallest\n"
+"                            distance in fuzzy tests, best first\n"
 "     --xml (toggle)         output results in XML format\n"
 "     -c, --compact          compact search results\n"
 "     -v, --verbose          verbose search results\n"
@@ -257,6 +292,10 @@ static void dump_help() {
 
 static const char *formatstring;
 static const char *eix_cachefile(NULLPTR);
+static const char *fuzzy_top_arg(NULLPTR);
+static const char *jobs_arg(NULLPTR);
+static const char *rdeps_arg(NULLPTR);
+static const char *batch_arg(NULLPTR);
 static const char *var_to_print(NULLPTR);
 
 enum OverlayMode {
@@ -317,7 +356,9 @@ static struct LocalOptions {
 		hash_license,
 		hash_depend,
 		print_profile_paths,
-		world_sets;
+		world_sets,
+		stats,
+		explain;
 } rc_options;
 
 /**
@@ -364,6 +405,8 @@ EixOptionList::EixOptionList() {
 	push_back(Option("known-vars",   O_KNOWN_VARS, Option::BOOLEAN_T, &rc_options.known_vars));
 	push_back(Option("test-non-matching", 't', Option::BOOLEAN_T,     &rc_options.test_unused));
 	push_back(Option("debug",         O_DEBUG, Option::BOOLEAN_T,     &rc_options.do_debug));
+	push_back(Option("stats",         O_STATS, Option::BOOLEAN_T,     &rc_options.stats));
+	push_back(Option("explain",       O_EXPLAIN, Option::BOOLEAN_T,   &rc_options.explain));
 
 	push_back(Option("print-all-eapis",     O_HASH_EAPI,     Option::BOOLEAN_T, &rc_options.hash_eapi));
 	push_back(Option("print-all-useflags",  O_HASH_IUSE,     Option::BOOLEAN_T, &rc_options.hash_iuse));
@@ -381,6 +424,10 @@ EixOptionList::EixOptionList() {
 	push_back(Option("format",         O_FMT,         Option::STRING,   &formatstring));
 
 	push_back(Option("cache-file",     O_EIX_CACHEFILE, Option::STRING, &eix_cachefile));
+	push_back(Option("fuzzy-top",      O_FUZZY_TOP,   Option::STRING,   &fuzzy_top_arg));
+	push_back(Option("jobs",           O_JOBS,        Option::STRING,   &jobs_arg));
+	push_back(Option("rdeps",          O_RDEPENDS,    Option::STRING,   &rdeps_arg));
+	push_back(Option("batch",          O_BATCH,       Option::STRING,   &batch_arg));
 	push_back(Option("remote",         'R', Option::BOOLEAN, &rc_options.remote));
 	push_back(Option("remote2",        'Z', Option::BOOLEAN, &rc_options.remote2));
 
@@ -600,6 +647,8 @@ static void set_format(EixRc *rc) {
 }
 
 int run_eix(int argc, char** argv) {
+	Stats::init("eix");
+
 	// Initialize static classes
 	Eapi::init_static();
 	ExtendedVersion::init_static();
@@ -625,6 +674,14 @@ int run_eix(int argc, char** argv) {
 
 	// Read our options from the commandline.
 	ArgumentReader argreader(argc, argv, EixOptionList());
+	Stats::startup_done(rc_options.stats);
+
+	if(unlikely((fuzzy_top_arg != NULLPTR) &&
+		((*fuzzy_top_arg == '\0') || !is_numeric(fuzzy_top_arg) ||
+		(my_atoi(fuzzy_top_arg) == 0)))) {
+		cerr << eix::format(_("the argument of --fuzzy-top must be a positive number, not \"%s\"")) % fuzzy_top_arg << endl;
+		return EXIT_FAILURE;
+	}
 
 	if(unlikely(rc_options.ansi)) {
 		AnsiColor::AnsiPalette();
@@ -747,7 +804,9 @@ int run_eix(int argc, char** argv) {
 		overlay_mode = mode_list_none;
 	}
 
+	StatsTimer settings_timer(Stats::PHASE_SETTINGS);
 	PortageSettings portagesettings(&eixrc, true, false, rc_options.print_profile_paths);
+	settings_timer.finish();
 	if(unlikely(rc_options.print_profile_paths)) {
 		return EXIT_SUCCESS;
 	}
@@ -759,10 +818,14 @@ int run_eix(int argc, char** argv) {
 		eixrc.getBool("CARE_RESTRICT_INSTALLED"),
 		eixrc.getBool("USE_BUILD_TIME"));
 	varpkg_db.check_installed_overlays = eixrc.getBoolText("CHECK_INSTALLED_OVERLAYS", "repository");
+	if(!eixrc["EIX_VARDB_SNAPSHOT"].empty()) {
+		varpkg_db.use_snapshot(eixrc["EIX_VARDB_SNAPSHOT"]);
+	}
 
 	MaskList<Mask> *marked_list(NULLPTR);
 
 	/* Open database file */
+	StatsTimer header_timer(Stats::PHASE_HEADER);
 	Database db;
 	if(unlikely(!opencache(&db, cachefile.c_str(), tooltext))) {
 		return EXIT_FAILURE;
@@ -778,6 +841,7 @@ int run_eix(int argc, char** argv) {
 			% tooltext << endl;
 		return EXIT_FAILURE;
 	}
+	header_timer.finish();
 
 	if(unlikely(rc_options.hash_eapi)) {
 		header.eapi_hash.output();
@@ -803,6 +867,9 @@ int run_eix(int argc, char** argv) {
 		header.depend_hash.output_depends();
 		return EXIT_SUCCESS;
 	}
+	if(unlikely(rdeps_arg != NULLPTR)) {
+		return (print_rdepends(&db, header, &portagesettings, rdeps_arg) ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
 	if(unlikely(rc_options.world_sets)) {
 		const WordVec *p(portagesettings.get_world_sets());
 		for(WordVec::const_iterator it(p->begin());
@@ -834,12 +901,73 @@ int run_eix(int argc, char** argv) {
 
 	SetStability stability(&portagesettings, !rc_options.ignore_etc_portage, false, eixrc.getBool("ALWAYS_ACCEPT_KEYWORDS"));
 
+	if(unlikely(batch_arg != NULLPTR)) {
+		eix::ptr_list<Package>::size_type count(0);
+		StatsTimer timer(Stats::PHASE_SCAN);
+		if(unlikely(!run_batch(batch_arg, &db, &header, &portagesettings, &varpkg_db, &stability, &eixrc, only_printed, is_tty, &count))) {
+			return EXIT_FAILURE;
+		}
+		// The snapshot is only a cache, so failures are silently ignored
+		varpkg_db.write_snapshot(NULLPTR);
+		return match_status(&eixrc, count);
+	}
+
 	MatchTree *matchtree = new MatchTree(eixrc.getBool("DEFAULT_IS_OR"));
 	parse_cli(matchtree, &eixrc, &varpkg_db, &portagesettings, format, &stability, &header, &marked_list, argreader);
 
+	// The heap of the best fuzzy matches owns its packages, so it cannot be
+	// used if the packages are also collected for tests of unused entries
+	FuzzyTop *fuzzy_top(NULLPTR);
+	if(unlikely((fuzzy_top_arg != NULLPTR) && !rc_options.test_unused)) {
+		fuzzy_top = new FuzzyTop(my_atoi(fuzzy_top_arg));
+	}
+
+	unsigned int search_jobs((jobs_arg != NULLPTR) ? my_atoi(jobs_arg) : eixrc.getInteger("SEARCH_JOBS"));
+	if(search_jobs == 0) {
+		search_jobs = get_processors();
+	}
+	// The data of child processes would be lost
+	if(unlikely(rc_options.explain)) {
+		matchtree->explain();
+		search_jobs = 1;
+	}
+
 	eix::ptr_list<Package> matches;
 	eix::ptr_list<Package> all_packages; {
+		StatsTimer timer(Stats::PHASE_SCAN);
 		PackageReader reader(&db, header, &portagesettings);
+		// With the package index we need not read all packages for simple name tests
+		PackageIndex index(&db);
+		PackageIndex::Selection selection;
+		if(likely(!rc_options.test_unused)) {
+			eix::OffsetType start(db.tell());
+			bool have_index(index.init(header));
+			bool selected(have_index && matchtree->select(&index, &selection));
+			if(unlikely(rc_options.explain)) {
+				if(selected) {
+					cerr << eix::format(N_("the index selects %s package",
+						"the index selects %s packages", selection.size()))
+						% selection.size() << endl;
+				} else {
+					cerr << _("the index does not restrict the packages") << endl;
+				}
+			}
+			// With --brief, the sequential search stops early anyway
+			if(have_index && (search_jobs > 1) &&
+				!(only_printed && (rc_options.brief || rc_options.brief2)) &&
+				parallel_select(&db, header, &portagesettings, &index, matchtree, search_jobs, selected, &selection)) {
+				selected = true;
+			}
+			if(selected) {
+				reader.select(&index, &selection);
+			} else {
+				string errtext;
+				if(unlikely(!db.seekabs(start, &errtext))) {
+					cerr << errtext << endl;
+					return EXIT_FAILURE;
+				}
+			}
+		}
 		bool add_rest(false);
 		while(likely(reader.next())) {
 			if(unlikely(add_rest)) {
@@ -849,6 +977,10 @@ int run_eix(int argc, char** argv) {
 				if(unlikely(release == NULLPTR)) {
 					break;
 				}
+				if(unlikely(fuzzy_top != NULLPTR)) {
+					delete fuzzy_top->add(release);
+					continue;
+				}
 				matches.push_back(release);
 				if(unlikely(only_printed &&
 					(rc_options.brief ||
@@ -881,9 +1013,17 @@ int run_eix(int argc, char** argv) {
 		}
 	}
 
+	if(unlikely(rc_options.explain)) {
+		matchtree->print_explain();
+	}
 	// Delete old matchtree
 	delete matchtree;
 
+	if(unlikely(fuzzy_top != NULLPTR)) {
+		fuzzy_top->finish(&matches);
+		delete fuzzy_top;
+	}
+
 	if(unlikely(rc_options.test_unused)) {
 		bool empty(eixrc.getBool("TEST_FOR_EMPTY"));
 		cout << "\n";
@@ -935,9 +1075,521 @@ int run_eix(int argc, char** argv) {
 		}
 	}
 
+	StatsTimer print_timer(Stats::PHASE_PRINT);
+	eix::ptr_list<Package>::size_type count(print_matches(&matches, &header, &varpkg_db, &portagesettings, &stability, &eixrc, marked_list, only_printed, is_tty));
+	print_timer.finish();
+
+	// Delete matches (or all_packages, respectively)
+	if(unlikely(rc_options.test_unused)) {
+		all_packages.delete_and_clear();
+		matches.clear();
+	} else {
+		matches.delete_and_clear();
+	}
+	delete marked_list;
+	// The snapshot is only a cache, so failures are silently ignored
+	varpkg_db.write_snapshot(NULLPTR);
+
+	return match_status(&eixrc, count);
+}  // NOLINT(readability/fn_size)
+
+/**
+Append the numbers of those packages of candidates which match to matches
+@return false in case of a read error
+**/
+static bool match_packages(Database *db, const DBHeader& header, PortageSettings *portagesettings, PackageIndex *index, MatchTree *matchtree, const PackageIndex::Selection& candidates, PackageIndex::Selection *matches) {
+	PackageReader reader(db, header, portagesettings);
+	reader.select(index, &candidates);
+	for(PackageIndex::Selection::const_iterator it(candidates.begin());
+		likely(reader.next()); ++it) {
+		if(matchtree->match(&reader)) {
+			matches->push_back(*it);
+		}
+	}
+	return (reader.get_errtext() == NULLPTR);
+}
+
+static bool write_all(int fd, const char *data, string::size_type len) {
+	while(len != 0) {
+		ssize_t written(write(fd, data, len));
+		if(written < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		data += written;
+		len -= static_cast<string::size_type>(written);
+	}
+	return true;
+}
+
+static bool read_all(int fd, string *data) {
+	char buf[4096];
+	for(;;) {
+		ssize_t got(read(fd, buf, sizeof(buf)));
+		if(got == 0) {
+			return true;
+		}
+		if(got < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		data->append(buf, static_cast<string::size_type>(got));
+	}
+}
+
+/**
+Match the packages of *sel (or all packages if !selected) with jobs
+processes and replace *sel by the matching ones. The packages are split
+into consecutive ranges; since the numbers of the matches of each range
+are concatenated in order, *sel is in file (i.e. category) order.
+Processes are used instead of threads, because the tests fill caches of
+e.g. PortageSettings and VarDbPkg which are not thread-safe; after fork(),
+each process has its own copy of these and shares the mapped database.
+The caller reads the matches again sequentially; thus the output and the
+data which tests store in the packages are the same as without jobs.
+@return false if the packages should be matched sequentially instead
+**/
+static bool parallel_select(Database *db, const DBHeader& header, PortageSettings *portagesettings, PackageIndex *index, MatchTree *matchtree, unsigned int jobs, bool selected, PackageIndex::Selection *sel) {
+	// Without a mapping, the processes would share the file position
+	if(db->mapped(0, 0) == NULLPTR) {
+		return false;
+	}
+	eix::Treesize total(selected ? sel->size() : index->size());
+	if(jobs > total / SEARCH_JOBS_MIN_PACKAGES) {
+		jobs = total / SEARCH_JOBS_MIN_PACKAGES;
+	}
+	if(jobs <= 1) {
+		return false;
+	}
+	vector<PackageIndex::Selection> ranges(jobs);
+	for(unsigned int i(0); likely(i != jobs); ++i) {
+		eix::Treesize first((total * i) / jobs);
+		eix::Treesize last((total * (i + 1)) / jobs);
+		PackageIndex::Selection& range(ranges[i]);
+		if(selected) {
+			range.assign(sel->begin() + first, sel->begin() + last);
+			continue;
+		}
+		range.reserve(last - first);
+		for(; likely(first != last); ++first) {
+			range.push_back(first);
+		}
+	}
+	// Range 0 is matched by this process, the others by children
+	vector<pid_t> children(jobs, -1);
+	vector<int> fds(jobs, -1);
+	for(unsigned int i(1); likely(i != jobs); ++i) {
+		int pipefds[2];
+		if(unlikely(pipe(pipefds) != 0)) {
+			continue;
+		}
+		pid_t child(fork());
+		if(child == 0) {
+			close(pipefds[0]);
+			Stats::clear_counters();
+			// The first entry tells whether a fuzzy test stored a distance
+			// which influences the sorting of the output
+			PackageIndex::Selection matches(1, 0);
+			bool ok(match_packages(db, header, portagesettings, index, matchtree, ranges[i], &matches));
+			if(ok) {
+				matches[0] = (FuzzyAlgorithm::sort_by_levenshtein() ? 1 : 0);
+				// The counters of the statistics are appended
+				if(unlikely(Stats::enabled)) {
+					matches.insert(matches.end(), Stats::get_counters(),
+						Stats::get_counters() + Stats::COUNTER_COUNT);
+				}
+				ok = write_all(pipefds[1], reinterpret_cast<const char *>(&(matches[0])),
+					matches.size() * sizeof(eix::Treesize));
+			}
+			_exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+		}
+		close(pipefds[1]);
+		if(unlikely(child < 0)) {
+			close(pipefds[0]);
+			continue;
+		}
+		children[i] = child;
+		fds[i] = pipefds[0];
+	}
+	vector<PackageIndex::Selection> results(jobs);
+	bool ok(match_packages(db, header, portagesettings, index, matchtree, ranges[0], &(results[0])));
+	for(unsigned int i(1); likely(i != jobs); ++i) {
+		if(children[i] < 0) {
+			// fork() failed: match the range here
+			ok = (match_packages(db, header, portagesettings, index, matchtree, ranges[i], &(results[i])) && ok);
+			continue;
+		}
+		string data;
+		bool got(read_all(fds[i], &data));
+		close(fds[i]);
+		int status;
+		while((waitpid(children[i], &status, 0) < 0) && (errno == EINTR)) {
+		}
+		string::size_type extra(Stats::enabled ? Stats::COUNTER_COUNT : 0);
+		if(likely(got && WIFEXITED(status) && (WEXITSTATUS(status) == EXIT_SUCCESS) &&
+			(data.size() >= (extra + 1) * sizeof(eix::Treesize)) &&
+			(data.size() % sizeof(eix::Treesize) == 0))) {
+			PackageIndex::Selection& result(results[i]);
+			result.resize(data.size() / sizeof(eix::Treesize));
+			memcpy(&(result[0]), data.data(), data.size());
+			if(result[0] != 0) {
+				FuzzyAlgorithm::set_have_distances();
+			}
+			if(unlikely(extra != 0)) {
+				Stats::add_counters(&(result[result.size() - extra]));
+				result.resize(result.size() - extra);
+			}
+			result.erase(result.begin());
+			continue;
+		}
+		// The child failed: match the range here (and report errors)
+		ok = (match_packages(db, header, portagesettings, index, matchtree, ranges[i], &(results[i])) && ok);
+	}
+	if(unlikely(!ok)) {
+		// Let the sequential search report the error
+		return false;
+	}
+	sel->clear();
+	for(unsigned int i(0); likely(i != jobs); ++i) {
+		sel->insert(sel->end(), results[i].begin(), results[i].end());
+	}
+	return true;
+}
+
+/**
+The versions are found by the reverse dependency index; only the
+packages containing them are read.
+**/
+static bool print_rdepends(Database *db, const DBHeader& header, PortageSettings *portagesettings, const string& name) {
+	PackageIndex index(db);
+	if(unlikely(!(index.init(header) && index.have_rdepends()))) {
+		cerr << _("The database has no reverse dependencies; run eix-update with DEP=true") << endl;
+		return false;
+	}
+	PackageIndex::RDepends list;
+	if(unlikely(!index.select_rdepends(&list, name))) {
+		cerr << _("error while reading from database") << endl;
+		return false;
+	}
+	PackageIndex::Selection sel;
+	for(PackageIndex::RDepends::const_iterator it(list.begin()); likely(it != list.end()); ++it) {
+		sel.push_back(it->num);
+	}
+	PackageIndex::normalize(&sel);
+	PackageReader reader(db, header, portagesettings);
+	reader.select(&index, &sel);
+	PackageIndex::RDepends::const_iterator entry(list.begin());
+	for(PackageIndex::Selection::const_iterator num(sel.begin());
+		likely(num != sel.end()) && likely(reader.next()); ++num) {
+		if(unlikely(!reader.read())) {
+			break;
+		}
+		const Package *pkg(reader.get());
+		Package::const_iterator v(pkg->begin());
+		eix::UNumber version(0);
+		for(; likely(entry != list.end()) && (entry->num == *num); ++entry) {
+			for(; likely(v != pkg->end()) && (version != entry->version); ++v, ++version) {
+			}
+			if(unlikely(v == pkg->end())) {
+				continue;
+			}
+			cout << pkg->category << "/" << pkg->name << "-" << v->getFull();
+			if(v->overlay_key != 0) {
+				const string& label(header.getOverlay(v->overlay_key).label);
+				if(!label.empty()) {
+					cout << "::" << label;
+				}
+			}
+			if((entry->kinds & PackageIndex::DEPKIND_DEPEND) != 0) {
+				cout << " DEPEND";
+			}
+			if((entry->kinds & PackageIndex::DEPKIND_RDEPEND) != 0) {
+				cout << " RDEPEND";
+			}
+			if((entry->kinds & PackageIndex::DEPKIND_PDEPEND) != 0) {
+				cout << " PDEPEND";
+			}
+			if((entry->kinds & PackageIndex::DEPKIND_HDEPEND) != 0) {
+				cout << " HDEPEND";
+			}
+			cout << "\n";
+		}
+	}
+	const char *err_cstr(reader.get_errtext());
+	if(unlikely(err_cstr != NULLPTR)) {
+		cerr << err_cstr << endl;
+		return false;
+	}
+	return true;
+}
+
+/**
+The state of a package and of its installed versions which the tests of
+a query and the output may modify. With --batch each query works on its
+own copy, so that the result does not depend on the other queries.
+**/
+class PackageState {
+	private:
+		PackageSave m_versions;
+		MaskFlags m_local_collects;
+		vector<MaskFlags> m_saved_collects;
+		unsigned int m_fuzzy_distance;
+		InstVec *m_installed;
+		InstVec m_installed_copy;
+
+	public:
+		PackageState(const Package *p, VarDbPkg *varpkg_db) ATTRIBUTE_NONNULL_
+			: m_versions(p),
+			m_local_collects(p->local_collects),
+			m_saved_collects(p->saved_collects),
+			m_fuzzy_distance(p->fuzzy_distance),
+			m_installed(varpkg_db->getInstalledVector(*p)) {
+			if(m_installed != NULLPTR) {
+				m_installed_copy = *m_installed;
+			}
+		}
+
+		void restore(Package *p) const ATTRIBUTE_NONNULL_ {
+			m_versions.restore(p);
+			p->local_collects = m_local_collects;
+			p->saved_collects = m_saved_collects;
+			p->fuzzy_distance = m_fuzzy_distance;
+			if(m_installed != NULLPTR) {
+				*m_installed = m_installed_copy;
+			}
+		}
+};
+
+/**
+@return the type of an option with the same arguments which is only kept
+**/
+static Option::Type keep_type(Option::Type type) {
+	switch(type) {
+		case Option::STRING:
+		case Option::STRINGLIST:
+			return Option::KEEP_STRING;
+		case Option::STRING_OPTIONAL:
+		case Option::STRINGLIST_OPTIONAL:
+			return Option::KEEP_STRING_OPTIONAL;
+		case Option::PAIR:
+		case Option::PAIRLIST:
+			return Option::KEEP_PAIR;
+		case Option::PAIR_OPTIONAL:
+		case Option::PAIRLIST_OPTIONAL:
+			return Option::KEEP_PAIR_OPTIONAL;
+		case Option::KEEP:
+		case Option::KEEP_STRING:
+		case Option::KEEP_STRING_OPTIONAL:
+		case Option::KEEP_PAIR:
+		case Option::KEEP_PAIR_OPTIONAL:
+			return type;
+		default:
+			break;
+	}
+	return Option::KEEP;
+}
+
+/**
+Each nonempty line of filename not starting with # contains the
+arguments of a query, separated by spaces (which may be escaped by \).
+Only the options of search expressions are allowed in these lines.
+All queries are parsed first and then matched in a single pass over the
+database; if the index can restrict the packages for every query, only
+the union of these selections is read.
+The matches of each query are printed after a line with that query.
+**/
+static bool run_batch(const char *filename, Database *db, DBHeader *header, PortageSettings *portagesettings, VarDbPkg *varpkg_db, SetStability *stability, EixRc *eixrc, bool only_printed, bool is_tty, eix::ptr_list<Package>::size_type *count) {
+	LineVec lines;
+	string errtext;
+	if(unlikely(!pushback_lines(filename, &lines, false, false, 1, &errtext))) {
+		cerr << errtext << endl;
+		return false;
+	}
+	for(LineVec::iterator it(lines.begin()); it != lines.end(); ) {
+		if((*it)[0] == '#') {
+			it = lines.erase(it);
+		} else {
+			++it;
+		}
+	}
+	LineVec::size_type queries(lines.size());
+	// The parsed arguments point into args, so it must not be reallocated
+	vector<WordVec> args(queries);
+	vector<MatchTree *> trees(queries, NULLPTR);
+	vector<MaskList<Mask> *> marked_lists(queries, NULLPTR);
+	// The reader only keeps the options of a line, so that options which
+	// are not part of a search expression do not change global settings
+	// but can be rejected
+	EixOptionList all_options;
+	OptionList line_options(all_options);
+	for(OptionList::iterator it(line_options.begin());
+		likely(it != line_options.end()); ++it) {
+		it->type = keep_type(it->type);
+	}
+	for(LineVec::size_type i(0); likely(i != queries); ++i) {
+		split_string(&(args[i]), lines[i], true);
+		vector<char *> argv(1, const_cast<char *>("eix"));
+		for(WordVec::iterator it(args[i].begin()); likely(it != args[i].end()); ++it) {
+			argv.push_back(&((*it)[0]));
+		}
+		ArgumentReader argreader(static_cast<int>(argv.size()), &(argv[0]), line_options);
+		for(ArgumentReader::const_iterator it(argreader.begin());
+			likely(it != argreader.end()); ++it) {
+			if(it->type != Parameter::OPTION) {
+				continue;
+			}
+			for(OptionList::const_iterator opt(all_options.begin());
+				likely(opt != all_options.end()); ++opt) {
+				if(opt->shortopt != it->m_option) {
+					continue;
+				}
+				if(unlikely(keep_type(opt->type) != opt->type)) {
+					cerr << eix::format(_("%s: only search expressions are allowed, not --%s in line: %s"))
+						% filename % opt->longopt % lines[i] << endl;
+					for(LineVec::size_type j(0); likely(j != i); ++j) {
+						delete trees[j];
+						delete marked_lists[j];
+					}
+					return false;
+				}
+				break;
+			}
+		}
+		trees[i] = new MatchTree(eixrc->getBool("DEFAULT_IS_OR"));
+		parse_cli(trees[i], eixrc, varpkg_db, portagesettings, format, stability, header, &(marked_lists[i]), argreader);
+	}
+
+	vector<eix::ptr_list<Package> > matches(queries);
+	// The packages are shared by the queries, so if there are several,
+	// their state after each match is kept (parallel to matches) and
+	// restored before that query is printed
+	bool several(queries > 1);
+	vector<vector<PackageState *> > states(queries);
+	vector<bool> fuzzy(queries, false);
+	eix::ptr_list<Package> packages;
+	bool success(true); {
+		PackageReader reader(db, *header, portagesettings);
+		PackageIndex index(db);
+		PackageIndex::Selection selection;
+		eix::OffsetType start(db->tell());
+		bool selected(index.init(*header));
+		for(LineVec::size_type i(0); likely(selected && (i != queries)); ++i) {
+			PackageIndex::Selection sel;
+			if(!trees[i]->select(&index, &sel)) {
+				selected = false;
+				break;
+			}
+			PackageIndex::Selection previous;
+			previous.swap(selection);
+			std::set_union(previous.begin(), previous.end(),
+				sel.begin(), sel.end(), std::back_inserter(selection));
+		}
+		if(selected) {
+			reader.select(&index, &selection);
+		} else if(unlikely(!db->seekabs(start, &errtext))) {
+			cerr << errtext << endl;
+			success = false;
+		}
+		vector<LineVec::size_type> hits;
+		vector<PackageState *> hit_states;
+		while(likely(success && reader.next())) {
+			hits.clear();
+			hit_states.clear();
+			PackageState *clean(NULLPTR);
+			if(several) {
+				// The versions are needed for a complete clean state
+				if(unlikely(!reader.read(PackageReader::VERSIONS))) {
+					break;
+				}
+				clean = new PackageState(reader.get(), varpkg_db);
+			}
+			Package *package(reader.get());
+			for(LineVec::size_type i(0); likely(i != queries); ++i) {
+				if(clean != NULLPTR) {
+					clean->restore(package);
+				}
+				package->fuzzy_distance = 0;
+				FuzzyAlgorithm::init_static();
+				if(unlikely(trees[i]->match(&reader))) {
+					hits.push_back(i);
+					if(several) {
+						hit_states.push_back(new PackageState(package, varpkg_db));
+					}
+					if(FuzzyAlgorithm::sort_by_levenshtein()) {
+						fuzzy[i] = true;
+					}
+				}
+			}
+			delete clean;
+			if(likely(hits.empty())) {
+				if(unlikely(!reader.skip())) {
+					break;
+				}
+				continue;
+			}
+			Package *release(reader.release());
+			if(unlikely(release == NULLPTR)) {
+				for(vector<PackageState *>::iterator it(hit_states.begin());
+					likely(it != hit_states.end()); ++it) {
+					delete *it;
+				}
+				break;
+			}
+			packages.push_back(release);
+			for(vector<LineVec::size_type>::size_type j(0); likely(j != hits.size()); ++j) {
+				matches[hits[j]].push_back(release);
+				if(several) {
+					states[hits[j]].push_back(hit_states[j]);
+				}
+			}
+		}
+		const char *err_cstr(reader.get_errtext());
+		if(unlikely(err_cstr != NULLPTR)) {
+			cerr << err_cstr << endl;
+			success = false;
+		}
+	}
+	for(LineVec::size_type i(0); likely(i != queries); ++i) {
+		delete trees[i];
+		if(likely(success)) {
+			// Printing a package does not touch the state of other
+			// packages, so all states of this query can be restored first
+			vector<PackageState *>::const_iterator state(states[i].begin());
+			for(eix::ptr_list<Package>::iterator it(matches[i].begin());
+				likely(state != states[i].end()); ++it, ++state) {
+				(*state)->restore(*it);
+			}
+			FuzzyAlgorithm::init_static();
+			if(unlikely(fuzzy[i])) {
+				FuzzyAlgorithm::set_have_distances();
+			}
+			cout << "# " << lines[i] << "\n";
+			*count += print_matches(&(matches[i]), header, varpkg_db, portagesettings, stability, eixrc, marked_lists[i], only_printed, is_tty);
+		}
+		for(vector<PackageState *>::iterator it(states[i].begin());
+			likely(it != states[i].end()); ++it) {
+			delete *it;
+		}
+		matches[i].clear();
+		delete marked_lists[i];
+	}
+	packages.delete_and_clear();
+	return success;
+}
+
+/**
+Print the matches in the format chosen by the options and the number
+of matches.
+@return the number of (printed, if COUNT_ONLY_PRINTED) matches
+**/
+static eix::ptr_list<Package>::size_type print_matches(eix::ptr_list<Package> *matches, DBHeader *header, VarDbPkg *varpkg_db, PortageSettings *portagesettings, SetStability *stability, EixRc *eixrc, MaskList<Mask> *marked_list, bool only_printed, bool is_tty) {
 	/* Sort the found matches by rating */
 	if(unlikely(FuzzyAlgorithm::sort_by_levenshtein())) {
-		matches.sort(FuzzyAlgorithm::compare);
+		matches->sort(FuzzyAlgorithm::compare);
 	}
 
 	format->set_marked_list(marked_list);
@@ -945,7 +1597,7 @@ int run_eix(int argc, char** argv) {
 		format->set_overlay_translations(NULLPTR);
 	}
 	bool need_overlay_table(false);
-	PrintFormat::OverlayUsed overlay_used(header.countOverlays(), false);
+	PrintFormat::OverlayUsed overlay_used(header->countOverlays(), false);
 	format->set_overlay_used(&overlay_used, &need_overlay_table);
 	eix::ptr_list<Package>::size_type count(0);
 	PrintXml *print_xml(NULLPTR);
@@ -953,18 +1605,18 @@ int run_eix(int argc, char** argv) {
 		overlay_mode = mode_list_none;
 		rc_options.pure_packages = true;
 	}
-	if(rc_options.xml && !matches.empty()) {
-		print_xml = new PrintXml(&header, &varpkg_db, format, &stability, &eixrc,
-			portagesettings["PORTDIR"]);
+	if(rc_options.xml && !matches->empty()) {
+		print_xml = new PrintXml(header, varpkg_db, format, stability, eixrc,
+			(*portagesettings)["PORTDIR"]);
 		print_xml->start();
 	}
 	bool have_printed(false);
 	bool reached_limit(false), over_limit(false);
 	string limit_var(rc_options.compact_output ? "EIX_LIMIT_COMPACT" : "EIX_LIMIT");
-	eix::Treesize limit(is_tty ? eixrc.getInteger(limit_var) : 0);
-	for(eix::ptr_list<Package>::iterator it(matches.begin());
-		likely(it != matches.end()); ++it) {
-		stability.set_stability(*it);
+	eix::Treesize limit(is_tty ? eixrc->getInteger(limit_var) : 0);
+	for(eix::ptr_list<Package>::iterator it(matches->begin());
+		likely(it != matches->end()); ++it) {
+		stability->set_stability(*it);
 
 		if(unlikely(rc_options.xml)) {
 			print_xml->package(*it);
@@ -984,7 +1636,7 @@ int run_eix(int argc, char** argv) {
 			}
 		}
 		if(overlay_mode != mode_list_used_renumbered) {
-			if(format->print(*it, &header, &varpkg_db, &portagesettings, &stability, reached_limit)) {
+			if(format->print(*it, header, varpkg_db, portagesettings, stability, reached_limit)) {
 				have_printed = true;
 				++count;
 				if(unlikely(reached_limit)) {
@@ -1008,7 +1660,7 @@ int run_eix(int argc, char** argv) {
 		default:
 			break;
 	}
-	PrintFormat::OverlayTranslations overlay_num(header.countOverlays(), 0);
+	PrintFormat::OverlayTranslations overlay_num(header->countOverlays(), 0);
 	if(overlay_mode == mode_list_used_renumbered) {
 		ExtendedVersion::Overlay i(1);
 		PrintFormat::OverlayUsed::iterator uit(overlay_used.begin());
@@ -1019,9 +1671,9 @@ int run_eix(int argc, char** argv) {
 			}
 		}
 		format->set_overlay_translations(&overlay_num);
-		for(eix::ptr_list<Package>::iterator it(matches.begin());
-			likely(it != matches.end()); ++it) {
-			if(format->print(*it, &header, &varpkg_db, &portagesettings, &stability, reached_limit)) {
+		for(eix::ptr_list<Package>::iterator it(matches->begin());
+			likely(it != matches->end()); ++it) {
+			if(format->print(*it, header, varpkg_db, portagesettings, stability, reached_limit)) {
 				have_printed = true;
 				++count;
 				if(unlikely(reached_limit)) {
@@ -1037,7 +1689,7 @@ int run_eix(int argc, char** argv) {
 	}
 	bool printed_overlay(false);
 	if(need_overlay_table) {
-		if(print_overlay_table(format, &header,
+		if(print_overlay_table(format, header,
 			(overlay_mode <= mode_list_used)? &overlay_used : NULLPTR)) {
 			printed_overlay = have_printed = true;
 		}
@@ -1048,10 +1700,10 @@ int run_eix(int argc, char** argv) {
 	}
 
 	if(!only_printed) {
-		count = matches.size();
+		count = matches->size();
 	}
 	eix::SignedBool print_count_always(rc_options.pure_packages ? -1 :
-		eixrc.getBoolText("PRINT_COUNT_ALWAYS", "never"));
+		eixrc->getBoolText("PRINT_COUNT_ALWAYS", "never"));
 	if(likely(print_count_always >= 0)) {
 		if((print_count_always != 0) || (count > 1)) {
 			have_printed = true;
@@ -1080,28 +1732,22 @@ int run_eix(int argc, char** argv) {
 				% limit % limit_var;
 		}
 	}
+	return count;
+}
 
-	// Delete matches (or all_packages, respectively)
-	if(unlikely(rc_options.test_unused)) {
-		all_packages.delete_and_clear();
-		matches.clear();
-	} else {
-		matches.delete_and_clear();
-	}
-	delete marked_list;
-
+static int match_status(EixRc *eixrc, eix::ptr_list<Package>::size_type count) {
 	if(unlikely(!count)) {
 GCC_DIAG_OFF(sign-conversion)
-		return eixrc.getInteger("NOFOUND_STATUS");
+		return eixrc->getInteger("NOFOUND_STATUS");
 GCC_DIAG_ON(sign-conversion)
 	}
 	if(count > 1) {
 GCC_DIAG_OFF(sign-conversion)
-		return eixrc.getInteger("MOREFOUND_STATUS");
+		return eixrc->getInteger("MOREFOUND_STATUS");
 GCC_DIAG_ON(sign-conversion)
 	}
 	return EXIT_SUCCESS;
-}  // NOLINT(readability/fn_size)
+}
 
 static bool opencache(Database *db, const char *filename, const char *tooltext) {
 	if(likely(db->openread(filename))) {
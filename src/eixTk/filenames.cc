@@ -43,6 +43,7 @@
 #include "eixTk/null.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/sysutils.h"
+#include "eixTk/utils.h"
 
 // If we still don't have PATH_MAX, try to use MAXPATHLEN:
 
@@ -93,6 +94,7 @@ NORMALIZE_PATH_EXPORT string NORMALIZE_PATH(const char *path, bool resolve, bool
 	}
 	string name;
 	if(resolve) {
+		FileStamps::record(path);
 		char *normalized(NULLPTR);
 #ifdef HAVE_CANONICALIZE_FILE_NAME
 		normalized = canonicalize_file_name(path);
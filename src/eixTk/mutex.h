@@ -0,0 +1,81 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#ifndef SRC_EIXTK_MUTEX_H_
+#define SRC_EIXTK_MUTEX_H_ 1
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#include "eixTk/null.h"
+
+namespace eix {
+
+/**
+A mutex which does nothing if eix is compiled without thread support
+**/
+class Mutex {
+	public:
+#ifdef HAVE_PTHREAD_H
+		Mutex() {
+			pthread_mutex_init(&m_mutex, NULLPTR);
+		}
+
+		~Mutex() {
+			pthread_mutex_destroy(&m_mutex);
+		}
+
+		void lock() {
+			pthread_mutex_lock(&m_mutex);
+		}
+
+		void unlock() {
+			pthread_mutex_unlock(&m_mutex);
+		}
+
+	private:
+		pthread_mutex_t m_mutex;
+#else
+		Mutex() {
+		}
+
+		void lock() {
+		}
+
+		void unlock() {
+		}
+#endif
+
+	private:
+		Mutex(const Mutex&);
+		Mutex& operator=(const Mutex&);
+};
+
+/**
+Locks the mutex for the lifetime of the object
+**/
+class MutexLocker {
+	public:
+		explicit MutexLocker(Mutex *mutex) ATTRIBUTE_NONNULL_ : m_mutex(mutex) {
+			m_mutex->lock();
+		}
+
+		~MutexLocker() {
+			m_mutex->unlock();
+		}
+
+	private:
+		Mutex *m_mutex;
+
+		MutexLocker(const MutexLocker&);
+		MutexLocker& operator=(const MutexLocker&);
+};
+
+}/* namespace eix */
+
+#endif  // SRC_EIXTK_MUTEX_H_
@@ -9,7 +9,9 @@
 
 #include <config.h>
 
+#include <cctype>
 #include <cstdlib>
+#include <cstring>
 
 #include <iostream>
 #include <string>
@@ -19,6 +21,9 @@
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
 #include "eixTk/regexp.h"
+#include "eixTk/regexp_dfa.h"
+#include "eixTk/stats.h"
+#include "eixTk/stringmatch.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/stringutils.h"
 
@@ -36,16 +41,18 @@ void Regex::free() {
 		regfree(&m_re);
 		m_compiled = false;
 	}
+	delete m_dfa;
+	m_dfa = NULLPTR;
+	m_prefilter.clear();
+	m_matchers.clear();
+	m_first.clear();
 }
 
 /**
 Compile a regular expression
 **/
 void Regex::compile(const char *regex, int eflags) {
-	if(unlikely(m_compiled)) {
-		regfree(&m_re);
-		m_compiled = false;
-	}
+	free();
 	if((regex == NULLPTR) || (regex[0] == '\0')) {
 		return;
 	}
@@ -58,6 +65,111 @@ void Regex::compile(const char *regex, int eflags) {
 		exit(EXIT_FAILURE);
 	}
 	m_compiled = true;
+	if((eflags & ~(REG_EXTENDED|REG_ICASE)) != 0) {
+		return;
+	}
+	bool icase((eflags & REG_ICASE) != 0);
+	init_prefilter(regex, icase);
+	m_dfa = new RegexDfa;
+	if(!m_dfa->compile(regex, icase)) {
+		delete m_dfa;
+		m_dfa = NULLPTR;
+	}
+}
+
+/**
+Choose the longest literal of each top-level alternative of regex.
+In multibyte locales, case folding with REG_ICASE is only predictable
+for ASCII characters.
+**/
+void Regex::init_prefilter(const char *regex, bool icase) {
+	for(unsigned int b(0); likely(b != 256); ++b) {
+		m_fold[b] = static_cast<unsigned char>(icase ? tolower(static_cast<int>(b)) : b);
+	}
+	vector<WordVec> alternatives;
+	if(!literals(regex, &alternatives)) {
+		return;
+	}
+	bool ascii_only(icase && (MB_CUR_MAX > 1));
+	WordVec prefilter;
+	for(vector<WordVec>::const_iterator alt(alternatives.begin());
+		likely(alt != alternatives.end()); ++alt) {
+		string best;
+		for(WordVec::const_iterator it(alt->begin()); likely(it != alt->end()); ++it) {
+			string::size_type start(0);
+			while(start < it->size()) {
+				string::size_type end(it->size());
+				if(ascii_only) {
+					for(end = start; (end < it->size()) &&
+						((static_cast<unsigned char>((*it)[end]) & 0x80) == 0); ++end) {
+					}
+				}
+				if(end - start > best.size()) {
+					best.assign(*it, start, end - start);
+				}
+				start = end + 1;
+			}
+		}
+		if(best.empty()) {
+			return;
+		}
+		for(string::iterator it(best.begin()); likely(it != best.end()); ++it) {
+			*it = static_cast<char>(m_fold[static_cast<unsigned char>(*it)]);
+		}
+		prefilter.push_back(best);
+	}
+	bool ascii_fold(true);
+	for(unsigned int b(0); likely(b != 256); ++b) {
+		if(m_fold[b] != (((b >= 'A') && (b <= 'Z')) ? (b | 0x20) : b)) {
+			ascii_fold = false;
+			break;
+		}
+	}
+	for(WordVec::const_iterator it(prefilter.begin());
+		likely(it != prefilter.end()); ++it) {
+		if(ascii_fold) {
+			m_matchers.push_back(StringMatcher());
+			m_matchers.back().set_pattern(*it, icase);
+		} else {
+			string first;
+			for(unsigned int b(1); likely(b != 256); ++b) {
+				if(m_fold[b] == static_cast<unsigned char>((*it)[0])) {
+					first.append(1, static_cast<char>(b));
+				}
+			}
+			m_first.push_back(first);
+		}
+	}
+	m_prefilter.swap(prefilter);
+}
+
+/**
+@return false if s contains none of the literals of m_prefilter
+**/
+bool Regex::prefilter(const char *s) const {
+	for(vector<StringMatcher>::const_iterator it(m_matchers.begin());
+		likely(it != m_matchers.end()); ++it) {
+		if(it->contains(s)) {
+			return true;
+		}
+	}
+	// Only for locales with a case folding different from ASCII
+	for(WordVec::size_type i(0); i != m_first.size(); ++i) {
+		const string& word(m_prefilter[i]);
+		const char *first(m_first[i].c_str());
+		for(const char *p(strpbrk(s, first)); p != NULLPTR; p = strpbrk(p + 1, first)) {
+			string::size_type j(1);
+			// The terminating '\0' is never equal to a character of word
+			while((j != word.size()) &&
+				(m_fold[static_cast<unsigned char>(p[j])] == static_cast<unsigned char>(word[j]))) {
+				++j;
+			}
+			if(j == word.size()) {
+				return true;
+			}
+		}
+	}
+	return false;
 }
 
 /**
@@ -65,7 +177,17 @@ void Regex::compile(const char *regex, int eflags) {
 @return true if the regular expression matches
 **/
 bool Regex::match(const char *s) const {
-	return (!m_compiled) || (!regexec(get(), s, 0, NULLPTR, 0));
+	Stats::count(Stats::REGEX_MATCHES);
+	if(!m_compiled) {
+		return true;
+	}
+	if(!m_prefilter.empty() && !prefilter(s)) {
+		return false;
+	}
+	if(m_dfa != NULLPTR) {
+		return m_dfa->match(s);
+	}
+	return !regexec(get(), s, 0, NULLPTR, 0);
 }
 
 /**
@@ -76,6 +198,7 @@ bool Regex::match(const char *s) const {
 **/
 bool Regex::match(const char *s, string::size_type *b, string::size_type *e) const {
 	regmatch_t pmatch[1];
+	Stats::count(Stats::REGEX_MATCHES);
 	if(!m_compiled) {
 		if(likely(b != NULLPTR)) {
 			*b = 0;
@@ -107,6 +230,155 @@ GCC_DIAG_ON(sign-conversion)
 	return true;
 }
 
+static void push_run(WordVec *words, string *run) ATTRIBUTE_NONNULL_;
+static void push_run(WordVec *words, string *run) {
+	if(!run->empty()) {
+		words->push_back(*run);
+		run->clear();
+	}
+}
+
+/**
+@return position of the ] closing the bracket expression at i or npos
+**/
+string::size_type skip_bracket(const string& s, string::size_type i, bool fnmatch_style) {
+	string::size_type j(i + 1);
+	if((j < s.size()) && ((s[j] == '^') || (fnmatch_style && (s[j] == '!')))) {
+		++j;
+	}
+	if((j < s.size()) && (s[j] == ']')) {
+		++j;
+	}
+	for(; likely(j < s.size()); ++j) {
+		if(s[j] == ']') {
+			return j;
+		}
+		if((s[j] == '[') && (j + 1 < s.size()) &&
+			((s[j + 1] == ':') || (s[j + 1] == '.') || (s[j + 1] == '='))) {
+			// [:class:], [.coll.], [=equiv=]
+			string end(1, s[j + 1]);
+			end.append(1, ']');
+			j = s.find(end, j + 2);
+			if(j == string::npos) {
+				return j;
+			}
+			++j;
+		}
+	}
+	return string::npos;
+}
+
+/**
+@return position of the ) closing the group at i or npos
+**/
+static string::size_type skip_group(const string& s, string::size_type i) ATTRIBUTE_PURE;
+static string::size_type skip_group(const string& s, string::size_type i) {
+	unsigned int depth(0);
+	for(string::size_type j(i); likely(j < s.size()); ++j) {
+		switch(s[j]) {
+			case '\\':
+				++j;
+				break;
+			case '[':
+				j = skip_bracket(s, j, false);
+				if(j == string::npos) {
+					return j;
+				}
+				break;
+			case '(':
+				++depth;
+				break;
+			case ')':
+				if(--depth == 0) {
+					return j;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+	return string::npos;
+}
+
+/**
+Only a simple subset of extended regular expressions is analyzed:
+Each top-level alternative contributes its runs of ordinary characters
+which are not made optional; everything else just ends the current run.
+**/
+bool Regex::literals(const string& s, vector<WordVec> *alternatives) {
+	vector<WordVec> result;
+	WordVec words;
+	string run;
+	for(string::size_type i(0); likely(i < s.size()); ++i) {
+		switch(s[i]) {
+			case '|':
+				push_run(&words, &run);
+				if(words.empty()) {
+					return false;
+				}
+				result.push_back(WordVec());
+				result.back().swap(words);
+				break;
+			case '*':
+			case '?':
+			case '{':
+				// The quantifier refers to the last character only
+				if(!run.empty()) {
+					run.erase(run.size() - 1);
+				}
+				push_run(&words, &run);
+				if(s[i] == '{') {
+					i = s.find('}', i);
+					if(i == string::npos) {
+						return false;
+					}
+				}
+				break;
+			case '(':
+				push_run(&words, &run);
+				i = skip_group(s, i);
+				if(i == string::npos) {
+					return false;
+				}
+				break;
+			case '[':
+				push_run(&words, &run);
+				i = skip_bracket(s, i, false);
+				if(i == string::npos) {
+					return false;
+				}
+				break;
+			case '\\':
+				// Only escaped special characters are known to be literal
+				if((i + 1 < s.size()) && (strchr(".[]()*+?{}|^$\\", s[i + 1]) != NULLPTR)) {
+					run.append(1, s[++i]);
+				} else {
+					push_run(&words, &run);
+					++i;
+				}
+				break;
+			case '+':
+			case '.':
+			case '^':
+			case '$':
+			case ')':
+				push_run(&words, &run);
+				break;
+			default:
+				run.append(1, s[i]);
+				break;
+		}
+	}
+	push_run(&words, &run);
+	if(words.empty()) {
+		return false;
+	}
+	result.push_back(WordVec());
+	result.back().swap(words);
+	alternatives->insert(alternatives->end(), result.begin(), result.end());
+	return true;
+}
+
 RegexList::RegexList(const string& stringlist) {
 	WordVec l;
 	split_string(&l, stringlist, true);
@@ -17,11 +17,19 @@
 #include <string>
 #include <vector>
 
+#include "eixTk/null.h"
+#include "eixTk/stringmatch.h"
+#include "eixTk/stringtypes.h"
+
+class RegexDfa;
 
 /**
 Handle regular expressions.
 It is normally used within global scope so that a regular expression doesn't
 have to be compiled with every instance of a class using it.
+For match(s) a string is first scanned for a literal required by the
+regular expression; if the regular expression is simple enough, the rest
+is done by a RegexDfa, otherwise by regexec().
 **/
 
 class Regex {
@@ -29,20 +37,20 @@ class Regex {
 		/**
 		Initalize class
 		**/
-		Regex() : m_compiled(false) {
+		Regex() : m_compiled(false), m_dfa(NULLPTR) {
 		}
 
 		/**
 		Initalize and compile regular expression
 		**/
-		Regex(const char *regex, int eflags) : m_compiled(false) {
+		Regex(const char *regex, int eflags) : m_compiled(false), m_dfa(NULLPTR) {
 			compile(regex, eflags);
 		}
 
 		/**
 		Initalize and compile regular expression
 		**/
-		explicit Regex(const char *regex) : m_compiled(false) {
+		explicit Regex(const char *regex) : m_compiled(false), m_dfa(NULLPTR) {
 			compile(regex, REG_EXTENDED);
 		}
 
@@ -81,6 +89,13 @@ class Regex {
 			return m_compiled;
 		}
 
+		/**
+		Append to alternatives the literals required by the extended
+		regular expression s, one WordVec for each top-level alternative
+		@return false if some alternative has no literal we know of
+		**/
+		static bool literals(const std::string& s, std::vector<WordVec> *alternatives) ATTRIBUTE_NONNULL_;
+
 	protected:
 		/**
 		Get the internal regular expression structure
@@ -98,8 +113,32 @@ class Regex {
 		Is the regex already compiled and nonempty?
 		**/
 		bool m_compiled;
+
+		/**
+		The DFA or NULLPTR if regexec() has to be used
+		**/
+		RegexDfa *m_dfa;
+
+		/**
+		One of these literals (mapped by m_fold) must occur in a match.
+		If m_prefilter is empty, no prefiltering happens.
+		Usually the literals are searched with m_matchers; only if m_fold
+		is not the ASCII case folding, m_first contains all bytes which are
+		mapped to the first character of the corresponding literal.
+		**/
+		WordVec m_prefilter, m_first;
+		std::vector<StringMatcher> m_matchers;
+		unsigned char m_fold[256];
+
+		bool prefilter(const char *s) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+		void init_prefilter(const char *regex, bool icase) ATTRIBUTE_NONNULL_;
 };
 
+/**
+@return position of the ] closing the bracket expression at i or npos
+**/
+std::string::size_type skip_bracket(const std::string& s, std::string::size_type i, bool fnmatch_style) ATTRIBUTE_PURE;
+
 class RegexList {
 	public:
 		explicit RegexList(const std::string& stringlist);
@@ -0,0 +1,630 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#include <config.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "eixTk/likely.h"
+#include "eixTk/null.h"
+#include "eixTk/regexp_dfa.h"
+
+using std::string;
+using std::vector;
+
+using std::sort;
+
+/**
+Larger regular expressions are left to regexec()
+**/
+static const vector<int>::size_type max_nodes = 10000;
+
+/**
+If the DFA gets larger, it is built anew
+**/
+static const vector<int>::size_type max_states = 2000;
+
+/**
+The characters which are literal after a backslash
+**/
+static const char escaped_chars[] = ".[]()*+?{}|^$\\";
+
+static bool add_class(std::bitset<256> *chars, const string& name) ATTRIBUTE_NONNULL_;
+
+/**
+Add the bytes of the character class name (in the current locale)
+@return false if name is unknown
+**/
+static bool add_class(std::bitset<256> *chars, const string& name) {
+	int (*is_class)(int);
+	if(name == "alpha") {
+		is_class = isalpha;
+	} else if(name == "digit") {
+		is_class = isdigit;
+	} else if(name == "alnum") {
+		is_class = isalnum;
+	} else if(name == "upper") {
+		is_class = isupper;
+	} else if(name == "lower") {
+		is_class = islower;
+	} else if(name == "space") {
+		is_class = isspace;
+	} else if(name == "blank") {
+		is_class = isblank;
+	} else if(name == "punct") {
+		is_class = ispunct;
+	} else if(name == "print") {
+		is_class = isprint;
+	} else if(name == "graph") {
+		is_class = isgraph;
+	} else if(name == "cntrl") {
+		is_class = iscntrl;
+	} else if(name == "xdigit") {
+		is_class = isxdigit;
+	} else {
+		return false;
+	}
+	for(unsigned int b(1); likely(b != 256); ++b) {
+		if((*is_class)(static_cast<int>(b)) != 0) {
+			chars->set(b);
+		}
+	}
+	return true;
+}
+
+bool RegexDfa::compile(const char *regex, bool icase) {
+	m_nodes.clear();
+	m_charsets.clear();
+	m_states.clear();
+	m_state_map.clear();
+	m_transitions.clear();
+	m_regex.assign(regex);
+	m_pos = 0;
+	m_icase = icase;
+	m_utf8 = false;
+	if(MB_CUR_MAX > 1) {
+		// Besides single-byte locales, only UTF-8 is supported
+		wchar_t wc;
+		std::mbstate_t state;
+		memset(&state, 0, sizeof(state));
+		if((std::mbrtowc(&wc, "\xc3\xa9", 2, &state) != 2) || (wc != 0xe9)) {
+			return false;
+		}
+		m_utf8 = true;
+	}
+	Fragment f;
+	if(!parse_alternatives(&f, 0) || (m_pos != m_regex.size()) ||
+		(m_nodes.size() > max_nodes)) {
+		return false;
+	}
+	m_nodes[f.end].out = add_node(NODE_MATCH, -1);
+	m_start = f.start;
+	m_marks.assign(m_nodes.size(), 0);
+	clear_states();
+	return true;
+}
+
+bool RegexDfa::match(const char *s) const {
+	StateIndex state(0);
+	for(const unsigned char *p(reinterpret_cast<const unsigned char *>(s)); ; ++p) {
+		if(m_states[state].match) {
+			return true;
+		}
+		if(*p == '\0') {
+			return m_states[state].match_at_end;
+		}
+		int next(m_transitions[state * 256 + *p]);
+		state = ((likely(next >= 0)) ? StateIndex(next) : transition(state, *p));
+	}
+}
+
+RegexDfa::NodeIndex RegexDfa::add_node(NodeType type, NodeIndex out) {
+	Node node;
+	node.type = type;
+	node.chars = 0;
+	node.out = out;
+	node.out1 = -1;
+	m_nodes.push_back(node);
+	return NodeIndex(m_nodes.size() - 1);
+}
+
+RegexDfa::Fragment RegexDfa::make_empty() {
+	Fragment f;
+	f.start = f.end = add_node(NODE_EMPTY, -1);
+	return f;
+}
+
+RegexDfa::Fragment RegexDfa::make_chars(const CharSet& chars) {
+	Fragment f;
+	f.end = add_node(NODE_EMPTY, -1);
+	f.start = add_node(NODE_CHARS, f.end);
+	m_nodes[f.start].chars = m_charsets.size();
+	m_charsets.push_back(chars);
+	return f;
+}
+
+/**
+A valid UTF-8 sequence of 2, 3, or 4 bytes
+**/
+RegexDfa::Fragment RegexDfa::make_multibyte() {
+	CharSet follow, lead2, lead3, lead4;
+	for(unsigned int b(0x80); b != 0xc0; ++b) {
+		follow.set(b);
+	}
+	for(unsigned int b(0xc2); b != 0xe0; ++b) {
+		lead2.set(b);
+	}
+	for(unsigned int b(0xe0); b != 0xf0; ++b) {
+		lead3.set(b);
+	}
+	for(unsigned int b(0xf0); b != 0xf5; ++b) {
+		lead4.set(b);
+	}
+	Fragment f(make_chars(lead2));
+	concat(&f, make_chars(follow));
+	Fragment g(make_chars(lead3));
+	for(unsigned int i(0); i != 2; ++i) {
+		concat(&g, make_chars(follow));
+	}
+	alternate(&f, g);
+	g = make_chars(lead4);
+	for(unsigned int i(0); i != 3; ++i) {
+		concat(&g, make_chars(follow));
+	}
+	alternate(&f, g);
+	return f;
+}
+
+RegexDfa::Fragment RegexDfa::make_assertion(NodeType type) {
+	Fragment f;
+	f.end = add_node(NODE_EMPTY, -1);
+	f.start = add_node(type, f.end);
+	return f;
+}
+
+void RegexDfa::concat(Fragment *a, const Fragment& b) {
+	m_nodes[a->end].out = b.start;
+	a->end = b.end;
+}
+
+void RegexDfa::alternate(Fragment *a, const Fragment& b) {
+	NodeIndex end(add_node(NODE_EMPTY, -1));
+	NodeIndex split(add_node(NODE_SPLIT, a->start));
+	m_nodes[split].out1 = b.start;
+	m_nodes[a->end].out = end;
+	m_nodes[b.end].out = end;
+	a->start = split;
+	a->end = end;
+}
+
+void RegexDfa::star(Fragment *a) {
+	NodeIndex end(add_node(NODE_EMPTY, -1));
+	NodeIndex split(add_node(NODE_SPLIT, a->start));
+	m_nodes[split].out1 = end;
+	m_nodes[a->end].out = split;
+	a->start = split;
+	a->end = end;
+}
+
+void RegexDfa::plus(Fragment *a) {
+	NodeIndex end(add_node(NODE_EMPTY, -1));
+	NodeIndex split(add_node(NODE_SPLIT, a->start));
+	m_nodes[split].out1 = end;
+	m_nodes[a->end].out = split;
+	a->end = end;
+}
+
+void RegexDfa::optional(Fragment *a) {
+	NodeIndex end(add_node(NODE_EMPTY, -1));
+	NodeIndex split(add_node(NODE_SPLIT, a->start));
+	m_nodes[split].out1 = end;
+	m_nodes[a->end].out = end;
+	a->start = split;
+	a->end = end;
+}
+
+bool RegexDfa::parse_alternatives(Fragment *f, unsigned int depth) {
+	if(!parse_branch(f, depth)) {
+		return false;
+	}
+	while((m_pos < m_regex.size()) && (m_regex[m_pos] == '|')) {
+		++m_pos;
+		Fragment g;
+		if(!parse_branch(&g, depth)) {
+			return false;
+		}
+		alternate(f, g);
+	}
+	return true;
+}
+
+bool RegexDfa::parse_branch(Fragment *f, unsigned int depth) {
+	*f = make_empty();
+	while(m_pos < m_regex.size()) {
+		char c(m_regex[m_pos]);
+		if(c == '|') {
+			break;
+		}
+		if(c == ')') {
+			// An unmatched ) is left to regexec()
+			return (depth != 0);
+		}
+		Fragment g;
+		if(!parse_piece(&g, depth) || unlikely(m_nodes.size() > max_nodes)) {
+			return false;
+		}
+		concat(f, g);
+	}
+	return true;
+}
+
+bool RegexDfa::parse_piece(Fragment *f, unsigned int depth) {
+	string::size_type atom_pos(m_pos);
+	bool is_assertion;
+	if(!parse_atom(f, depth, &is_assertion)) {
+		return false;
+	}
+	if(m_pos == m_regex.size()) {
+		return true;
+	}
+	char c(m_regex[m_pos]);
+	if((c != '*') && (c != '+') && (c != '?') && (c != '{')) {
+		return true;
+	}
+	if(is_assertion) {
+		return false;
+	}
+	++m_pos;
+	if(c == '*') {
+		star(f);
+	} else if(c == '+') {
+		plus(f);
+	} else if(c == '?') {
+		optional(f);
+	} else {
+		// {m}, {m,}, {,n}, or {m,n}
+		unsigned int min(0), max;
+		bool bounded(true);
+		if((m_pos < m_regex.size()) && (m_regex[m_pos] != ',') && !parse_bound(&min)) {
+			return false;
+		}
+		if((m_pos < m_regex.size()) && (m_regex[m_pos] == ',')) {
+			++m_pos;
+			if((m_pos < m_regex.size()) && (m_regex[m_pos] == '}')) {
+				bounded = false;
+				max = min;
+			} else if(!parse_bound(&max)) {
+				return false;
+			}
+		} else {
+			max = min;
+		}
+		if((m_pos == m_regex.size()) || (m_regex[m_pos] != '}') || (max < min)) {
+			return false;
+		}
+		string::size_type end_pos(m_pos + 1);
+		unsigned int copies(bounded ? max : ((min == 0) ? 1 : min));
+		Fragment result(make_empty());
+		for(unsigned int i(0); i != copies; ++i) {
+			Fragment g;
+			if(i == 0) {
+				g = *f;
+			} else {
+				m_pos = atom_pos;
+				if(!parse_atom(&g, depth, &is_assertion) ||
+					unlikely(m_nodes.size() > max_nodes)) {
+					return false;
+				}
+			}
+			if(!bounded && (i + 1 == copies)) {
+				if(min == 0) {
+					star(&g);
+				} else {
+					plus(&g);
+				}
+			} else if(i >= min) {
+				optional(&g);
+			}
+			concat(&result, g);
+		}
+		*f = result;
+		m_pos = end_pos;
+	}
+	// Several quantifiers in a row are left to regexec()
+	return ((m_pos == m_regex.size()) ||
+		(strchr("*+?{", m_regex[m_pos]) == NULLPTR));
+}
+
+bool RegexDfa::parse_bound(unsigned int *n) {
+	string::size_type start(m_pos);
+	*n = 0;
+	for(; (m_pos < m_regex.size()) && (m_regex[m_pos] >= '0') && (m_regex[m_pos] <= '9'); ++m_pos) {
+		*n = 10 * (*n) + static_cast<unsigned int>(m_regex[m_pos] - '0');
+		if(*n > 255) {
+			return false;
+		}
+	}
+	return (m_pos != start);
+}
+
+bool RegexDfa::parse_atom(Fragment *f, unsigned int depth, bool *is_assertion) {
+	*is_assertion = false;
+	unsigned char c(m_regex[m_pos]);
+	CharSet chars;
+	switch(c) {
+		case '(':
+			++m_pos;
+			if((m_pos < m_regex.size()) && (m_regex[m_pos] == ')')) {
+				++m_pos;
+				*f = make_empty();
+				return true;
+			}
+			if(!parse_alternatives(f, depth + 1) ||
+				(m_pos == m_regex.size()) || (m_regex[m_pos] != ')')) {
+				return false;
+			}
+			++m_pos;
+			return true;
+		case '[':
+			return parse_bracket(f);
+		case '.':
+			++m_pos;
+			chars.set();
+			chars.reset(0);
+			if(m_utf8) {
+				for(unsigned int b(0x80); b != 256; ++b) {
+					chars.reset(b);
+				}
+				*f = make_chars(chars);
+				alternate(f, make_multibyte());
+			} else {
+				*f = make_chars(chars);
+			}
+			return true;
+		case '^':
+		case '$':
+			++m_pos;
+			*f = make_assertion((c == '^') ? NODE_BEGIN : NODE_END);
+			*is_assertion = true;
+			return true;
+		case '\\':
+			if((m_pos + 1 == m_regex.size()) ||
+				(strchr(escaped_chars, m_regex[m_pos + 1]) == NULLPTR)) {
+				// Back references and GNU extensions like \< or \w
+				return false;
+			}
+			c = m_regex[++m_pos];
+			break;
+		case '*':
+		case '+':
+		case '?':
+		case '{':
+		case '|':
+		case ')':
+			return false;
+		default:
+			if(m_utf8 && (c >= 0x80)) {
+				return false;
+			}
+			break;
+	}
+	++m_pos;
+	chars.set(c);
+	fold_case(&chars);
+	*f = make_chars(chars);
+	return true;
+}
+
+bool RegexDfa::parse_bracket(Fragment *f) {
+	++m_pos;
+	bool negate(false);
+	if((m_pos < m_regex.size()) && (m_regex[m_pos] == '^')) {
+		negate = true;
+		++m_pos;
+	}
+	CharSet chars;
+	for(bool first(true); ; first = false) {
+		if(m_pos == m_regex.size()) {
+			return false;
+		}
+		unsigned char c(m_regex[m_pos]);
+		if((c == ']') && !first) {
+			++m_pos;
+			break;
+		}
+		if((c == '[') && (m_pos + 1 < m_regex.size())) {
+			char d(m_regex[m_pos + 1]);
+			if((d == '.') || (d == '=')) {
+				return false;
+			}
+			if(d == ':') {
+				// In UTF-8, classes contain multibyte characters
+				if(m_utf8) {
+					return false;
+				}
+				string::size_type end(m_regex.find(":]", m_pos + 2));
+				if((end == string::npos) ||
+					!add_class(&chars, m_regex.substr(m_pos + 2, end - m_pos - 2))) {
+					return false;
+				}
+				m_pos = end + 2;
+				continue;
+			}
+		}
+		if(m_utf8 && (c >= 0x80)) {
+			return false;
+		}
+		++m_pos;
+		if((m_pos + 1 < m_regex.size()) && (m_regex[m_pos] == '-') &&
+			(m_regex[m_pos + 1] != ']')) {
+			unsigned char e(m_regex[m_pos + 1]);
+			if((e == '[') || (m_utf8 && (e >= 0x80)) || (e < c)) {
+				return false;
+			}
+			for(unsigned int b(c); b <= e; ++b) {
+				chars.set(b);
+			}
+			m_pos += 2;
+			continue;
+		}
+		chars.set(c);
+	}
+	fold_case(&chars);
+	if(negate) {
+		chars.flip();
+	}
+	chars.reset(0);
+	if(negate && m_utf8) {
+		for(unsigned int b(0x80); b != 256; ++b) {
+			chars.reset(b);
+		}
+		*f = make_chars(chars);
+		alternate(f, make_multibyte());
+		return true;
+	}
+	*f = make_chars(chars);
+	return true;
+}
+
+/**
+With REG_ICASE, regexec() compares the lowercase variants of the
+characters, so we add all bytes with the same lowercase variant
+**/
+void RegexDfa::fold_case(CharSet *chars) const {
+	if(!m_icase) {
+		return;
+	}
+	CharSet lower;
+	for(unsigned int b(1); likely(b != 256); ++b) {
+		if((*chars)[b]) {
+			lower.set(static_cast<unsigned char>(tolower(static_cast<int>(b))));
+		}
+	}
+	for(unsigned int b(1); likely(b != 256); ++b) {
+		if(lower[static_cast<unsigned char>(tolower(static_cast<int>(b)))]) {
+			chars->set(b);
+		}
+	}
+}
+
+void RegexDfa::closure(const NodeSet& seeds, bool at_begin, bool at_end, NodeSet *result) const {
+	result->clear();
+	m_stack.assign(seeds.begin(), seeds.end());
+	NodeSet touched;
+	while(!m_stack.empty()) {
+		NodeIndex n(m_stack.back());
+		m_stack.pop_back();
+		if(m_marks[n] != 0) {
+			continue;
+		}
+		m_marks[n] = 1;
+		touched.push_back(n);
+		const Node& node(m_nodes[n]);
+		switch(node.type) {
+			case NODE_CHARS:
+			case NODE_MATCH:
+				result->push_back(n);
+				break;
+			case NODE_SPLIT:
+				m_stack.push_back(node.out1);
+				m_stack.push_back(node.out);
+				break;
+			case NODE_BEGIN:
+				if(at_begin) {
+					m_stack.push_back(node.out);
+				}
+				break;
+			case NODE_END:
+				if(at_end) {
+					m_stack.push_back(node.out);
+				} else {
+					result->push_back(n);
+				}
+				break;
+			// case NODE_EMPTY:
+			default:
+				m_stack.push_back(node.out);
+				break;
+		}
+	}
+	for(NodeSet::const_iterator it(touched.begin()); likely(it != touched.end()); ++it) {
+		m_marks[*it] = 0;
+	}
+	sort(result->begin(), result->end());
+}
+
+/**
+The initial state (at_begin = true) is always state 0 and not stored in
+m_state_map, because it differs from a later state with the same nodes
+in the handling of anchors.
+**/
+RegexDfa::StateIndex RegexDfa::add_state(const NodeSet& seeds, bool at_begin) const {
+	State state;
+	closure(seeds, at_begin, false, &state.nodes);
+	if(!at_begin) {
+		std::map<NodeSet, StateIndex>::const_iterator it(m_state_map.find(state.nodes));
+		if(it != m_state_map.end()) {
+			return it->second;
+		}
+	}
+	state.match = state.match_at_end = false;
+	NodeSet at_end;
+	closure(seeds, at_begin, true, &at_end);
+	for(NodeSet::const_iterator it(at_end.begin()); likely(it != at_end.end()); ++it) {
+		if(m_nodes[*it].type == NODE_MATCH) {
+			state.match_at_end = true;
+			break;
+		}
+	}
+	for(NodeSet::const_iterator it(state.nodes.begin()); likely(it != state.nodes.end()); ++it) {
+		if(m_nodes[*it].type == NODE_MATCH) {
+			state.match = true;
+			break;
+		}
+	}
+	StateIndex index(m_states.size());
+	if(!at_begin) {
+		m_state_map[state.nodes] = index;
+	}
+	m_states.push_back(state);
+	m_transitions.resize(m_transitions.size() + 256, -1);
+	return index;
+}
+
+RegexDfa::StateIndex RegexDfa::transition(StateIndex state, unsigned char c) const {
+	// Since we search for a match anywhere, a match can also start here
+	NodeSet seeds(1, m_start);
+	const NodeSet& nodes(m_states[state].nodes);
+	for(NodeSet::const_iterator it(nodes.begin()); likely(it != nodes.end()); ++it) {
+		const Node& node(m_nodes[*it]);
+		if((node.type == NODE_CHARS) && m_charsets[node.chars][c]) {
+			seeds.push_back(node.out);
+		}
+	}
+	if(unlikely(m_states.size() >= max_states)) {
+		clear_states();
+		return add_state(seeds, false);
+	}
+	StateIndex next(add_state(seeds, false));
+	m_transitions[state * 256 + c] = static_cast<int>(next);
+	return next;
+}
+
+void RegexDfa::clear_states() const {
+	m_states.clear();
+	m_state_map.clear();
+	m_transitions.clear();
+	add_state(NodeSet(1, m_start), true);
+}
@@ -0,0 +1,132 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#ifndef SRC_EIXTK_REGEXP_DFA_H_
+#define SRC_EIXTK_REGEXP_DFA_H_ 1
+
+#include <bitset>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+A matcher for the common subset of extended regular expressions:
+Characters, ".", bracket expressions, groups, alternatives, the
+quantifiers "*", "+", "?", "{m,n}", and the anchors "^" and "$".
+The regular expression is translated into an NFA from which a DFA is
+built lazily while matching, so that each byte is looked at only once.
+Only whether a string contains a match is determined.
+Since the DFA is extended by match(), the object must not be used
+by several threads simultaneously.
+**/
+class RegexDfa {
+	public:
+		RegexDfa() : m_start(0) {
+		}
+
+		/**
+		@return false if regex uses constructs which are not supported
+		(or if the locale is unsuitable); then regexec() must be used
+		**/
+		bool compile(const char *regex, bool icase) ATTRIBUTE_NONNULL_;
+
+		/**
+		@return true if s contains a match
+		**/
+		bool match(const char *s) const ATTRIBUTE_NONNULL_;
+
+	private:
+		typedef std::bitset<256> CharSet;
+		typedef std::vector<CharSet>::size_type CharSetIndex;
+		typedef int NodeIndex;
+		typedef std::vector<NodeIndex> NodeSet;
+		typedef std::vector<NodeSet>::size_type StateIndex;
+
+		enum NodeType {
+			NODE_CHARS,  ///< Consume a character of chars
+			NODE_SPLIT,  ///< Continue with out and out1
+			NODE_EMPTY,  ///< Continue with out
+			NODE_BEGIN,  ///< Continue with out at the beginning of the string
+			NODE_END,    ///< Continue with out at the end of the string
+			NODE_MATCH
+		};
+
+		class Node {
+			public:
+				NodeType type;
+				CharSetIndex chars;
+				NodeIndex out, out1;
+		};
+
+		/**
+		A part of the NFA; end is a NODE_EMPTY whose out is not yet set
+		**/
+		class Fragment {
+			public:
+				NodeIndex start, end;
+		};
+
+		class State {
+			public:
+				NodeSet nodes;
+				bool match, match_at_end;
+		};
+
+		std::vector<Node> m_nodes;
+		std::vector<CharSet> m_charsets;
+		NodeIndex m_start;
+
+		/**
+		Parser state
+		**/
+		std::string m_regex;
+		std::string::size_type m_pos;
+		bool m_icase, m_utf8;
+
+		/**
+		The lazily built DFA: The states, the map to find them,
+		and the transitions (-1 if not yet known) for each byte
+		**/
+		mutable std::vector<State> m_states;
+		mutable std::map<NodeSet, StateIndex> m_state_map;
+		mutable std::vector<int> m_transitions;
+
+		/**
+		Scratch space for closure()
+		**/
+		mutable std::vector<char> m_marks;
+		mutable NodeSet m_stack;
+
+		NodeIndex add_node(NodeType type, NodeIndex out);
+		Fragment make_empty();
+		Fragment make_chars(const CharSet& chars);
+		Fragment make_multibyte();
+		Fragment make_assertion(NodeType type);
+		void concat(Fragment *a, const Fragment& b) ATTRIBUTE_NONNULL_;
+		void alternate(Fragment *a, const Fragment& b) ATTRIBUTE_NONNULL_;
+		void star(Fragment *a) ATTRIBUTE_NONNULL_;
+		void plus(Fragment *a) ATTRIBUTE_NONNULL_;
+		void optional(Fragment *a) ATTRIBUTE_NONNULL_;
+
+		bool parse_alternatives(Fragment *f, unsigned int depth) ATTRIBUTE_NONNULL_;
+		bool parse_branch(Fragment *f, unsigned int depth) ATTRIBUTE_NONNULL_;
+		bool parse_piece(Fragment *f, unsigned int depth) ATTRIBUTE_NONNULL_;
+		bool parse_atom(Fragment *f, unsigned int depth, bool *is_assertion) ATTRIBUTE_NONNULL_;
+		bool parse_bracket(Fragment *f) ATTRIBUTE_NONNULL_;
+		bool parse_bound(unsigned int *n) ATTRIBUTE_NONNULL_;
+		void fold_case(CharSet *chars) const ATTRIBUTE_NONNULL_;
+
+		/**
+		Collect the nodes reachable from seeds without consuming characters
+		**/
+		void closure(const NodeSet& seeds, bool at_begin, bool at_end, NodeSet *result) const ATTRIBUTE_NONNULL_;
+		StateIndex add_state(const NodeSet& seeds, bool at_begin) const;
+		StateIndex transition(StateIndex state, unsigned char c) const;
+		void clear_states() const;
+};
+
+#endif  // SRC_EIXTK_REGEXP_DFA_H_
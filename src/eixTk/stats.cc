@@ -0,0 +1,280 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#include <config.h>
+
+#ifdef HAVE_GETTIMEOFDAY
+#include <sys/time.h>
+#endif
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "eixTk/eixint.h"
+#include "eixTk/formated.h"
+#include "eixTk/likely.h"
+#include "eixTk/null.h"
+#include "eixTk/stats.h"
+
+using std::cerr;
+using std::endl;
+using std::string;
+using std::vector;
+
+bool Stats::enabled = false;
+const char *Stats::program_name = NULLPTR;
+bool Stats::json = false;
+double Stats::start_wall = 0;
+double Stats::start_cpu = 0;
+Stats::Times Stats::times[PHASE_COUNT];
+eix::UNumber Stats::counters[COUNTER_COUNT];
+vector<Stats::Repo> Stats::repos;
+
+unsigned int StatsTimer::depth[Stats::PHASE_COUNT];
+
+static const char *phase_names[Stats::PHASE_COUNT] = {
+	"eixrc",
+	"settings",
+	"header",
+	"read",
+	"scan",
+	"vardb",
+	"masks",
+	"cache",
+	"write",
+	"print"
+};
+
+static const char *counter_names[Stats::COUNTER_COUNT] = {
+	"packages_visited",
+	"packages_decoded",
+	"bytes_read",
+	"seeks",
+	"regex_matches",
+	"vardb_files",
+	"cache_files"
+};
+
+static void json_string(const string& s);
+
+double Stats::wall() {
+#ifdef HAVE_GETTIMEOFDAY
+	struct timeval tv;
+	gettimeofday(&tv, NULLPTR);
+	return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1000000;
+#else
+	return static_cast<double>(time(NULLPTR));
+#endif
+}
+
+void Stats::now(double *wall_time, double *cpu) {
+	*wall_time = wall();
+	*cpu = static_cast<double>(clock()) / CLOCKS_PER_SEC;
+}
+
+/**
+The start time is also needed if the report is enabled later by --stats
+**/
+void Stats::init(const char *program) {
+	program_name = program;
+	now(&start_wall, &start_cpu);
+	const char *trace(getenv("EIX_TRACE"));
+	if((trace == NULLPTR) || (*trace == '\0')) {
+		return;
+	}
+	json = (strcmp(trace, "json") == 0);
+	enabled = true;
+	atexit(report);
+}
+
+void Stats::startup_done(bool enable) {
+	if(enable && !enabled) {
+		enabled = true;
+		atexit(report);
+	}
+	if(likely(!enabled)) {
+		return;
+	}
+	double wall_time, cpu;
+	now(&wall_time, &cpu);
+	add_time(PHASE_EIXRC, wall_time - start_wall, cpu - start_cpu);
+}
+
+void Stats::clear_counters() {
+	for(unsigned int i(0); likely(i != COUNTER_COUNT); ++i) {
+		counters[i] = 0;
+	}
+}
+
+void Stats::add_counters(const eix::UNumber *c) {
+	for(unsigned int i(0); likely(i != COUNTER_COUNT); ++i) {
+		count(Counter(i), c[i]);
+	}
+}
+
+void Stats::add_time(Phase phase, double wall_time, double cpu) {
+	Times& t(times[phase]);
+	t.wall += wall_time;
+	t.cpu += cpu;
+	++(t.calls);
+}
+
+void Stats::add_repo(const string& name, eix::UNumber files, double wall_time, double cpu) {
+	if(likely(!enabled)) {
+		return;
+	}
+	repos.push_back(Repo());
+	Repo& repo(repos.back());
+	repo.name = name;
+	repo.files = files;
+	repo.wall = wall_time;
+	repo.cpu = cpu;
+}
+
+void Stats::report() {
+	if(json) {
+		report_json();
+	} else {
+		report_text();
+	}
+	cerr.flush();
+}
+
+/**
+Milliseconds with 3 decimals, written as integer microseconds so that
+the result does not depend on the locale (LC_NUMERIC)
+**/
+static string milliseconds(double seconds) {
+	eix::UNumber us((seconds > 0) ? static_cast<eix::UNumber>(seconds * 1000000 + 0.5) : 0);
+	string fraction(eix::format() % (us % 1000));
+	fraction.insert(0, 3 - fraction.size(), '0');
+	return eix::format("%s.%s") % (us / 1000) % fraction;
+}
+
+/**
+Pad s with spaces to width: on the left if right is true
+**/
+static string align(const string& s, string::size_type width, bool right) {
+	if(s.size() >= width) {
+		return s;
+	}
+	string padding(width - s.size(), ' ');
+	return (right ? (padding + s) : (s + padding));
+}
+
+static string align(eix::UNumber n, string::size_type width) {
+	return align(eix::format() % n, width, true);
+}
+
+/**
+The phases may be nested (e.g. vardb or masks are mostly part of
+scan or print), so their times need not add up
+**/
+void Stats::report_text() {
+	double wall_time, cpu;
+	now(&wall_time, &cpu);
+	cerr << eix::format("%s: %s %s %s %s") % program_name
+		% align("phase", 10, false) % align("wall [ms]", 12, true)
+		% align("cpu [ms]", 12, true) % align("calls", 10, true) << endl;
+	for(unsigned int i(0); likely(i != PHASE_COUNT); ++i) {
+		const Times& t(times[i]);
+		if(t.calls == 0) {
+			continue;
+		}
+		cerr << eix::format("%s: %s %s %s %s") % program_name
+			% align(phase_names[i], 10, false)
+			% align(milliseconds(t.wall), 12, true)
+			% align(milliseconds(t.cpu), 12, true)
+			% align(t.calls, 10) << endl;
+	}
+	cerr << eix::format("%s: %s %s %s") % program_name
+		% align("total", 10, false)
+		% align(milliseconds(wall_time - start_wall), 12, true)
+		% align(milliseconds(cpu - start_cpu), 12, true) << endl;
+	for(unsigned int i(0); likely(i != COUNTER_COUNT); ++i) {
+		cerr << eix::format("%s: %s %s") % program_name
+			% align(counter_names[i], 20, false) % counters[i] << endl;
+	}
+	for(vector<Repo>::const_iterator it(repos.begin()); likely(it != repos.end()); ++it) {
+		cerr << eix::format("%s: repository %s: %s cache files, %s ms wall, %s ms cpu")
+			% program_name % it->name % it->files
+			% milliseconds(it->wall) % milliseconds(it->cpu) << endl;
+	}
+}
+
+void Stats::report_json() {
+	double wall_time, cpu;
+	now(&wall_time, &cpu);
+	cerr << "{\"program\":";
+	json_string(program_name);
+	cerr << ",\"phases\":{";
+	const char *sep("");
+	for(unsigned int i(0); likely(i != PHASE_COUNT); ++i) {
+		const Times& t(times[i]);
+		if(t.calls == 0) {
+			continue;
+		}
+		cerr << eix::format("%s\"%s\":{\"wall_ms\":%s,\"cpu_ms\":%s,\"calls\":%s}")
+			% sep % phase_names[i] % milliseconds(t.wall) % milliseconds(t.cpu)
+			% t.calls;
+		sep = ",";
+	}
+	cerr << eix::format("},\"total\":{\"wall_ms\":%s,\"cpu_ms\":%s},\"counters\":{")
+		% milliseconds(wall_time - start_wall) % milliseconds(cpu - start_cpu);
+	sep = "";
+	for(unsigned int i(0); likely(i != COUNTER_COUNT); ++i) {
+		cerr << eix::format("%s\"%s\":%s") % sep % counter_names[i] % counters[i];
+		sep = ",";
+	}
+	cerr << "},\"repositories\":[";
+	sep = "";
+	for(vector<Repo>::const_iterator it(repos.begin()); likely(it != repos.end()); ++it) {
+		cerr << sep << "{\"name\":";
+		json_string(it->name);
+		cerr << eix::format(",\"cache_files\":%s,\"wall_ms\":%s,\"cpu_ms\":%s}")
+			% it->files % milliseconds(it->wall) % milliseconds(it->cpu);
+		sep = ",";
+	}
+	cerr << "]}" << endl;
+}
+
+static void json_string(const string& s) {
+	static const char hex[] = "0123456789abcdef";
+	cerr << '"';
+	for(string::const_iterator it(s.begin()); likely(it != s.end()); ++it) {
+		unsigned char c(*it);
+		if((c == '"') || (c == '\\')) {
+			cerr << '\\' << *it;
+		} else if(unlikely(c < 0x20)) {
+			cerr << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+		} else {
+			cerr << *it;
+		}
+	}
+	cerr << '"';
+}
+
+void StatsTimer::start() {
+	m_active = true;
+	if(depth[m_phase]++ == 0) {
+		Stats::now(&m_wall, &m_cpu);
+	}
+}
+
+void StatsTimer::stop() {
+	if(--depth[m_phase] != 0) {
+		return;
+	}
+	double wall_time, cpu;
+	Stats::now(&wall_time, &cpu);
+	Stats::add_time(m_phase, wall_time - m_wall, cpu - m_cpu);
+}
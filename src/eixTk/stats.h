@@ -0,0 +1,175 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#ifndef SRC_EIXTK_STATS_H_
+#define SRC_EIXTK_STATS_H_ 1
+
+#include <string>
+#include <vector>
+
+#include "eixTk/eixint.h"
+#include "eixTk/likely.h"
+
+/**
+The times of the phases and some counters of eix, eix-update, and eix-diff.
+They are reported on stderr at exit if EIX_TRACE is set in the environment
+(as JSON if its value is "json") or if --stats is used.
+Otherwise, timers and counters only test the static flag enabled.
+**/
+class Stats {
+	public:
+		enum Phase {
+			PHASE_EIXRC,
+			PHASE_SETTINGS,
+			PHASE_HEADER,
+			PHASE_READ,
+			PHASE_SCAN,
+			PHASE_VARDB,
+			PHASE_MASKS,
+			PHASE_CACHE,
+			PHASE_WRITE,
+			PHASE_PRINT,
+			PHASE_COUNT
+		};
+
+		enum Counter {
+			PACKAGES_VISITED,
+			PACKAGES_DECODED,
+			BYTES_READ,
+			SEEKS,
+			REGEX_MATCHES,
+			VARDB_FILES,
+			CACHE_FILES,
+			COUNTER_COUNT
+		};
+
+		static bool enabled;
+
+		/**
+		Must be called at the beginning of the program
+		**/
+		static void init(const char *program) ATTRIBUTE_NONNULL_;
+
+		/**
+		Must be called when the options are parsed: Enable the report if
+		requested (e.g. by --stats) and account the time since init()
+		to PHASE_EIXRC.
+		**/
+		static void startup_done(bool enable);
+
+		static void count(Counter c, eix::UNumber n) {
+			if(unlikely(enabled)) {
+#ifdef HAVE___SYNC_FETCH_AND_ADD
+				__sync_fetch_and_add(&(counters[c]), n);
+#else
+				counters[c] += n;
+#endif
+			}
+		}
+
+		static void count(Counter c) {
+			count(c, 1);
+		}
+
+		static eix::UNumber counter(Counter c) {
+			return counters[c];
+		}
+
+		/**
+		Child processes start with cleared counters and pass them to
+		their parent which adds them
+		**/
+		static void clear_counters();
+		static void add_counters(const eix::UNumber *c) ATTRIBUTE_NONNULL_;
+		static const eix::UNumber *get_counters() {
+			return counters;
+		}
+
+		/**
+		The current wall clock time and the used CPU time in seconds
+		**/
+		static void now(double *wall_time, double *cpu) ATTRIBUTE_NONNULL_;
+
+		/**
+		The current wall clock time in seconds
+		**/
+		static double wall();
+
+		static void add_time(Phase phase, double wall_time, double cpu);
+
+		/**
+		Add the data of a repository read by eix-update
+		**/
+		static void add_repo(const std::string& name, eix::UNumber files, double wall_time, double cpu);
+
+	private:
+		class Times {
+			public:
+				double wall, cpu;
+				eix::UNumber calls;
+		};
+
+		class Repo {
+			public:
+				std::string name;
+				eix::UNumber files;
+				double wall, cpu;
+		};
+
+		static const char *program_name;
+		static bool json;
+		static double start_wall, start_cpu;
+		static Times times[PHASE_COUNT];
+		static eix::UNumber counters[COUNTER_COUNT];
+		static std::vector<Repo> repos;
+
+		static void report();
+		static void report_text();
+		static void report_json();
+};
+
+/**
+Measure the time of a phase during the lifetime of the object.
+Nested timers of the same phase are measured only once.
+**/
+class StatsTimer {
+	public:
+		explicit StatsTimer(Stats::Phase phase) : m_phase(phase), m_active(false) {
+			if(unlikely(Stats::enabled)) {
+				start();
+			}
+		}
+
+		~StatsTimer() {
+			finish();
+		}
+
+		/**
+		End the measurement before the object is destroyed
+		**/
+		void finish() {
+			if(unlikely(m_active)) {
+				m_active = false;
+				stop();
+			}
+		}
+
+	private:
+		Stats::Phase m_phase;
+		bool m_active;
+		double m_wall, m_cpu;
+
+		static unsigned int depth[Stats::PHASE_COUNT];
+
+		void start();
+		void stop();
+
+		StatsTimer(const StatsTimer&);
+		StatsTimer& operator=(const StatsTimer&);
+};
+
+#endif  // SRC_EIXTK_STATS_H_
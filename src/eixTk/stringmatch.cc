@@ -0,0 +1,142 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#include <config.h>
+
+#if defined(HAVE_EMMINTRIN_H) && defined(__SSE2__)
+#define USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#include <cstring>
+
+#include <string>
+
+#include "eixTk/likely.h"
+#include "eixTk/null.h"
+#include "eixTk/stringmatch.h"
+
+using std::string;
+
+static inline unsigned char fold(unsigned char c) ATTRIBUTE_CONST;
+static inline unsigned char fold(unsigned char c) {
+	return (((c >= 'A') && (c <= 'Z')) ? static_cast<unsigned char>(c | 0x20) : c);
+}
+
+void StringMatcher::set_pattern(const string& pattern, bool icase) {
+	m_pattern = pattern;
+	m_icase = icase;
+	if(icase) {
+		for(string::iterator it(m_pattern.begin()); likely(it != m_pattern.end()); ++it) {
+			*it = static_cast<char>(fold(static_cast<unsigned char>(*it)));
+		}
+	}
+}
+
+bool StringMatcher::equal_at(const char *s, string::size_type n) const {
+	const char *p(m_pattern.data());
+	if(!m_icase) {
+		return (memcmp(s, p, n) == 0);
+	}
+	string::size_type i(0);
+#ifdef USE_SSE2
+	const __m128i before_a(_mm_set1_epi8('A' - 1));
+	const __m128i after_z(_mm_set1_epi8('Z' + 1));
+	const __m128i bit(_mm_set1_epi8(0x20));
+	for(; i + 16 <= n; i += 16) {
+		__m128i x(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i)));
+		// Bytes >= 0x80 are negative and hence not considered as upper case
+		__m128i upper(_mm_and_si128(_mm_cmpgt_epi8(x, before_a), _mm_cmplt_epi8(x, after_z)));
+		x = _mm_or_si128(x, _mm_and_si128(upper, bit));
+		__m128i y(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)));
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF) {
+			return false;
+		}
+	}
+#endif
+	for(; i != n; ++i) {
+		if(fold(static_cast<unsigned char>(s[i])) != static_cast<unsigned char>(p[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool StringMatcher::equal(const char *s) const {
+	if(!m_icase) {
+		return (strcmp(s, m_pattern.c_str()) == 0);
+	}
+	string::size_type n(m_pattern.size());
+	return ((memchr(s, '\0', n) == NULLPTR) && (s[n] == '\0') && equal_at(s, n));
+}
+
+bool StringMatcher::begins(const char *s) const {
+	string::size_type n(m_pattern.size());
+	if(!m_icase) {
+		return (strncmp(s, m_pattern.c_str(), n) == 0);
+	}
+	return ((memchr(s, '\0', n) == NULLPTR) && equal_at(s, n));
+}
+
+bool StringMatcher::ends(const char *s) const {
+	string::size_type n(m_pattern.size());
+	string::size_type len(strlen(s));
+	return ((len >= n) && equal_at(s + (len - n), n));
+}
+
+/**
+Candidates are the positions where the first and the last byte of the
+pattern match; only for these the remaining bytes are compared.
+With SSE2, the candidates of 16 positions are determined at once;
+with icase, setting bit 0x20 of all bytes gives a superset of them.
+**/
+bool StringMatcher::contains(const char *s) const {
+	string::size_type n(m_pattern.size());
+	if(unlikely(n == 0)) {
+		return true;
+	}
+	if((n == 1) && !m_icase) {
+		return (strchr(s, m_pattern[0]) != NULLPTR);
+	}
+	string::size_type len(strlen(s));
+	if(len < n) {
+		return false;
+	}
+	string::size_type last(len - n);
+	unsigned char first(m_pattern[0]);
+	unsigned char final(m_pattern[n - 1]);
+	string::size_type i(0);
+#ifdef USE_SSE2
+	const char mask_bit(m_icase ? 0x20 : 0);
+	const __m128i bit(_mm_set1_epi8(mask_bit));
+	const __m128i first_vec(_mm_set1_epi8(static_cast<char>(first | mask_bit)));
+	const __m128i final_vec(_mm_set1_epi8(static_cast<char>(final | mask_bit)));
+	for(; i + 15 <= last; i += 16) {
+		__m128i a(_mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i)), bit));
+		__m128i b(_mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i + n - 1)), bit));
+		unsigned int candidates(static_cast<unsigned int>(_mm_movemask_epi8(
+			_mm_and_si128(_mm_cmpeq_epi8(a, first_vec), _mm_cmpeq_epi8(b, final_vec)))));
+		for(string::size_type j(i); candidates != 0; ++j, candidates >>= 1) {
+			if(((candidates & 1) != 0) && equal_at(s + j, n)) {
+				return true;
+			}
+		}
+	}
+#endif
+	for(; i <= last; ++i) {
+		unsigned char c(s[i]);
+		unsigned char d(s[i + n - 1]);
+		if(m_icase) {
+			c = fold(c);
+			d = fold(d);
+		}
+		if((c == first) && (d == final) && equal_at(s + i, n)) {
+			return true;
+		}
+	}
+	return false;
+}
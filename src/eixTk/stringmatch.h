@@ -0,0 +1,59 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#ifndef SRC_EIXTK_STRINGMATCH_H_
+#define SRC_EIXTK_STRINGMATCH_H_ 1
+
+#include <string>
+
+/**
+Compare nul-terminated strings with a fixed pattern without copying them.
+With icase, ASCII letters are compared case-insensitively (as in the C
+locale); all other bytes must be equal.
+If SSE2 is available, 16 bytes are compared at once.
+**/
+class StringMatcher {
+	public:
+		StringMatcher() : m_icase(false) {
+		}
+
+		void set_pattern(const std::string& pattern, bool icase);
+
+		/**
+		@return true if s equals the pattern
+		**/
+		bool equal(const char *s) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+
+		/**
+		@return true if s starts with the pattern
+		**/
+		bool begins(const char *s) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+
+		/**
+		@return true if s ends with the pattern
+		**/
+		bool ends(const char *s) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+
+		/**
+		@return true if s contains the pattern
+		**/
+		bool contains(const char *s) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+
+	private:
+		/**
+		The pattern; with m_icase in lowercase
+		**/
+		std::string m_pattern;
+		bool m_icase;
+
+		/**
+		@return true if the n bytes at s equal the first n bytes of m_pattern
+		**/
+		bool equal_at(const char *s, std::string::size_type n) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+};
+
+#endif  // SRC_EIXTK_STRINGMATCH_H_
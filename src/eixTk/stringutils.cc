@@ -238,15 +238,21 @@ GCC_DIAG_ON(sign-conversion)
 
 char **ExplodeAtom::split(const char *str) {
 	static char* out[2] = { NULLPTR, NULLPTR };
+	if(unlikely(!split(out, str)))
+		return NULLPTR;
+	return out;
+}
+
+bool ExplodeAtom::split(char **out, const char *str) {
 	const char *x(get_start_of_version(str, false));
 
 	if(unlikely(x == NULLPTR))
-		return NULLPTR;
+		return false;
 GCC_DIAG_OFF(sign-conversion)
 	out[0] = strndup(str, ((x - 1) - str));
 GCC_DIAG_ON(sign-conversion)
 	out[1] = strdup(x);
-	return out;
+	return true;
 }
 
 string to_lower(const string& str) {
@@ -498,37 +504,60 @@ StringHash::size_type StringHash::get_index(const string& s) const {
 	return i->second;
 }
 
-const string& StringHash::operator[](StringHash::size_type i) const {
-	if(i >= size()) {
+void StringHash::get(string *s, StringHash::size_type i) const {
+	if(unlikely(i >= size())) {
 		cerr << _("database corrupt: nonexistent hash required");
 		exit(EXIT_FAILURE);
 	}
-	return WordVec::operator[](i);
+	if(lazy_data == NULLPTR) {
+		*s = WordVec::operator[](i);
+		return;
+	}
+	size_type start(lazy_offset(i));
+	size_type end(lazy_offset(i + 1));
+	if(unlikely((end < start) || (end > lazy_end))) {
+		cerr << _("database corrupt: nonexistent hash required");
+		exit(EXIT_FAILURE);
+	}
+	s->assign(lazy_data + start, end - start);
+}
+
+StringHash::size_type StringHash::lazy_offset(StringHash::size_type i) const {
+	const unsigned char *p(reinterpret_cast<const unsigned char *>(lazy_offsets) + i * lazy_offset_bytes);
+	size_type ret(0);
+	for(unsigned int j(lazy_offset_bytes); likely(j != 0); --j) {
+		ret = (ret << 8) | *(p++);
+	}
+	return ret;
 }
 
 void StringHash::output() const {
-	for(WordVec::const_iterator i(begin()); likely(i != end()); ++i) {
-		cout << *i << "\n";
+	string s;
+	for(size_type i(0); likely(i != size()); ++i) {
+		get(&s, i);
+		cout << s << "\n";
 	}
 }
 
 void StringHash::output_depends() const {
 	WordSet out;
-	for(WordVec::const_iterator i(begin()); likely(i != end()); ++i) {
-		string::size_type q(i->find('"'));
+	string s;
+	for(size_type i(0); likely(i != size()); ++i) {
+		get(&s, i);
+		string::size_type q(s.find('"'));
 		if(q == string::npos) {
-			out.insert(*i);
+			out.insert(s);
 			continue;
 		}
 		if(q == 0) {
-			if(i->length() != 1) {
-				out.insert(string(*i, 1));
+			if(s.length() != 1) {
+				out.insert(string(s, 1));
 			}
 			continue;
 		}
-		out.insert(string(*i, 0, q));
-		if(++q != i->length()) {
-			out.insert(string(*i, q));
+		out.insert(string(s, 0, q));
+		if(++q != s.length()) {
+			out.insert(string(s, q));
 		}
 	}
 	for(WordSet::const_iterator i(out.begin()); likely(i != out.end()); ++i) {
@@ -92,6 +92,12 @@ class ExplodeAtom {
 		@warn You'll get a pointer to a static array of 2 pointer to char.
 		**/
 		static char **split(const char* str) ATTRIBUTE_NONNULL_;
+
+		/**
+		Reentrant variant of split(): name and version are stored in out
+		@return false if str cannot be split
+		**/
+		static bool split(char **out, const char* str) ATTRIBUTE_NONNULL_;
 };
 
 /**
@@ -414,19 +420,40 @@ inline static std::string::size_type utf8size(const std::string &t) {
 
 class StringHash : public WordVec {
 	public:
-		StringHash() : hashing(true), finalized(false) {
+		StringHash() : hashing(true), finalized(false), lazy_data(NULLPTR) {
 		}
 
-		explicit StringHash(bool will_hash) : hashing(will_hash), finalized(false) {
+		explicit StringHash(bool will_hash) : hashing(will_hash), finalized(false), lazy_data(NULLPTR) {
 		}
 
 		void init(bool will_hash) {
 			hashing = will_hash;
 			finalized = false;
+			lazy_data = NULLPTR;
 			clear();
 			str_map.clear();
 		}
 
+		/**
+		Resolve the entries only on demand from memory which must remain
+		valid: offsets contains count+1 big-endian numbers of width
+		offset_bytes, and entry i consists of the bytes from offset i
+		to offset i+1 (exclusive) of data.
+		**/
+		void init_lazy(const char *offsets, unsigned int offset_bytes, const char *data, size_type count) ATTRIBUTE_NONNULL_ {
+			init(false);
+			finalized = true;
+			lazy_offsets = offsets;
+			lazy_offset_bytes = offset_bytes;
+			lazy_data = data;
+			lazy_size = count;
+			lazy_end = lazy_offset(count);
+		}
+
+		size_type size() const {
+			return ((lazy_data == NULLPTR) ? WordVec::size() : lazy_size);
+		}
+
 		void finalize();
 
 		void store_string(const std::string& s);
@@ -446,10 +473,25 @@ class StringHash : public WordVec {
 		void output() const;
 		void output_depends() const;
 
-		const std::string& operator[](StringHash::size_type i) const;
+		/**
+		Copy entry i to s
+		**/
+		void get(std::string *s, StringHash::size_type i) const ATTRIBUTE_NONNULL_;
+
+		std::string operator[](StringHash::size_type i) const {
+			std::string s;
+			get(&s, i);
+			return s;
+		}
 
 	private:
 		bool hashing, finalized;
+		const char *lazy_offsets, *lazy_data;
+		unsigned int lazy_offset_bytes;
+		size_type lazy_size, lazy_end;
+
+		size_type lazy_offset(size_type i) const ATTRIBUTE_PURE;
+
 		typedef std::map<std::string, StringHash::size_type> StrSizeMap;
 		StrSizeMap str_map;
 		static StringHash *comparison_this;
@@ -163,3 +163,13 @@ bool get_geometry(unsigned int *lines ATTRIBUTE_UNUSED, unsigned int *columns AT
 	return false;
 }
 #endif
+
+unsigned int get_processors() {
+#if defined(HAVE_SYSCONF) && defined(_SC_NPROCESSORS_ONLN)
+	long n(sysconf(_SC_NPROCESSORS_ONLN));
+	if(likely(n > 0)) {
+		return static_cast<unsigned int>(n);
+	}
+#endif
+	return 1;
+}
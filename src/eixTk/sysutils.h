@@ -60,4 +60,9 @@ const char *date_conv(const char *dateFormat, time_t mydate) ATTRIBUTE_NONNULL_;
 **/
 bool get_geometry(unsigned int *width, unsigned int *columns) ATTRIBUTE_NONNULL_;
 
+/**
+@return the number of online processors or 1 if this cannot be determined
+**/
+unsigned int get_processors();
+
 #endif  // SRC_EIXTK_SYSUTILS_H_
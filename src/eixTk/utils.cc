@@ -10,8 +10,10 @@
 #include <config.h>
 
 #include <dirent.h>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 
 #include <cerrno>
 #include <cstdio>
@@ -19,6 +21,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <ctime>
 #include <fstream>
 #include <string>
 
@@ -60,7 +63,52 @@ class Directory {
 static bool pushback_lines_file(const char *file, WordVec *v, bool keep_empty, eix::SignedBool keep_comments, string *errtext) ATTRIBUTE_NONNULL((1, 2));
 static int pushback_files_selector(SCANDIR_ARG3 dir_entry);
 
+FileStamps *FileStamps::recorder = NULLPTR;
+
+void FileStamps::get_stamp(const char *file, Stamp *stamp) {
+	struct stat st;
+	if(unlikely(lstat(file, &st) != 0)) {
+		stamp->mtime = stamp->link = 0;
+		return;
+	}
+	if(likely(!S_ISLNK(st.st_mode))) {
+		stamp->mtime = st.st_mtime + 1;
+		stamp->link = 0;
+		return;
+	}
+	stamp->link = st.st_mtime + 1;
+	stamp->mtime = ((stat(file, &st) == 0) ? (st.st_mtime + 1) : 0);
+}
+
+/**
+A trailing slash (used to test for directories) is ignored
+so that each file is only stat()ed once.
+**/
+void FileStamps::add(const char *file) {
+	string name(file);
+	while((name.size() > 1) && (name[name.size() - 1] == '/')) {
+		name.erase(name.size() - 1);
+	}
+	if(stamps.find(name) == stamps.end()) {
+		get_stamp(name.c_str(), &(stamps[name]));
+	}
+}
+
+bool FileStamps::unreliable() const {
+	if(failed) {
+		return true;
+	}
+	time_t now(time(NULLPTR));
+	for(Stamps::const_iterator it(stamps.begin()); likely(it != stamps.end()); ++it) {
+		if(unlikely((it->second.mtime > now) || (it->second.link > now))) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool scandir_cc(const string& dir, WordVec *namelist, select_dirent select, bool sorted) {
+	FileStamps::record(dir.c_str());
 	namelist->clear(); {
 		Directory my_dir;
 		if(!my_dir.opendirectory(dir.c_str())) {
@@ -86,6 +134,7 @@ push_back every line of file into v.
 **/
 static bool pushback_lines_file(const char *file, LineVec *v, bool keep_empty, eix::SignedBool keep_comments, string *errtext) {
 	string line;
+	FileStamps::record(file);
 	std::ifstream ifstr(file);
 	if(unlikely(!ifstr.is_open())) {
 		if(errtext != NULLPTR) {
@@ -249,6 +298,41 @@ bool pushback_files(const string& dir_path, WordVec *into, const char *exclude[]
 Cycle through map using it, until it is it_end, append all values from it
 to the value with the same key in append_to.
 **/
+bool read_file_buffer(const char *file, string *buffer) {
+	int fd(open(file, O_RDONLY));
+	if(unlikely(fd < 0)) {
+		return false;
+	}
+	struct stat st;
+	string::size_type len(0);
+	// One more byte than needed so that EOF is detected without resizing
+	buffer->resize(((fstat(fd, &st) == 0) && (st.st_size > 0)) ?
+		(static_cast<string::size_type>(st.st_size) + 1) : 4096);
+	for(;;) {
+		if(unlikely(len == buffer->size())) {
+			buffer->resize(2 * len);
+		}
+		ssize_t r(read(fd, &((*buffer)[len]), buffer->size() - len));
+		if(likely(r > 0)) {
+			len += static_cast<string::size_type>(r);
+			continue;
+		}
+		if(likely(r == 0)) {
+			break;
+		}
+		if(errno != EINTR) {
+			int saved_errno(errno);
+			close(fd);
+			buffer->clear();
+			errno = saved_errno;
+			return false;
+		}
+	}
+	close(fd);
+	buffer->resize(len);
+	return true;
+}
+
 void join_map(WordMap *append_to, WordMap::const_iterator it, WordMap::const_iterator it_end) {
 	for(; likely(it != it_end); ++it) {
 		string& to((*append_to)[it->first]);
@@ -10,12 +10,80 @@
 #ifndef SRC_EIXTK_UTILS_H_
 #define SRC_EIXTK_UTILS_H_ 1
 
+#include <ctime>
+
+#include <map>
 #include <string>
 
 #include "eixTk/eixint.h"
+#include "eixTk/likely.h"
 #include "eixTk/null.h"
 #include "eixTk/stringtypes.h"
 
+/**
+The modification times of the files and directories which are read
+while a recorder is set. This allows to check later whether data
+computed from these files is still valid.
+**/
+class FileStamps {
+	public:
+		/**
+		mtime is 0 if the file does not exist, otherwise its mtime + 1.
+		link is the same for the symbolic link itself (0 if it is none).
+		**/
+		class Stamp {
+			public:
+				time_t mtime, link;
+
+				bool operator==(const Stamp& s) const {
+					return ((mtime == s.mtime) && (link == s.link));
+				}
+
+				bool operator!=(const Stamp& s) const {
+					return !(*this == s);
+				}
+		};
+
+		typedef std::map<std::string, Stamp> Stamps;
+		Stamps stamps;
+
+		/**
+		The data depends on something else than the files,
+		e.g. it caused a warning which must be shown again
+		**/
+		bool failed;
+
+		/**
+		The files read by the utilities of eixTk are recorded here
+		**/
+		static FileStamps *recorder;
+
+		FileStamps() : failed(false) {
+		}
+
+		static void record(const char *file) ATTRIBUTE_NONNULL_ {
+			if(unlikely(recorder != NULLPTR)) {
+				recorder->add(file);
+			}
+		}
+
+		static void fail() {
+			if(unlikely(recorder != NULLPTR)) {
+				recorder->failed = true;
+			}
+		}
+
+		static void get_stamp(const char *file, Stamp *stamp) ATTRIBUTE_NONNULL_;
+
+		void add(const char *file) ATTRIBUTE_NONNULL_;
+
+		/**
+		@return true if some file might still be changed within
+		the second of its modification time, or fail() was called
+		**/
+		bool unreliable() const ATTRIBUTE_PURE;
+};
+
 /**
 scandir which even works on poor man's systems.
 We keep the original type for the callback function
@@ -76,6 +144,13 @@ inline static bool pushback_files(const std::string& dir_path, WordVec *into, co
 	return pushback_files(dir_path, into, exclude, only_files, true, true);
 }
 
+/**
+Read the whole file into buffer. The capacity of buffer is reused
+so that reading many small files need not allocate memory.
+@return false if the file cannot be read; errno is then set
+**/
+bool read_file_buffer(const char *file, std::string *buffer) ATTRIBUTE_NONNULL_;
+
 /**
 Cycle through map using it, until it is it_end, append all values from it
 to the value with the same key in append_to.
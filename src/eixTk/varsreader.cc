@@ -1059,6 +1059,7 @@ bool VarsReader::read(const char *filename, string *errtext, bool noexist_ok, se
 			return true;
 		}
 	}
+	FileStamps::record(filename);
 	int fd(open(filename, O_RDONLY));
 	if(fd == -1) {
 		if(noexist_ok) {
@@ -9,6 +9,9 @@
 
 #include <config.h>
 
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -25,7 +28,9 @@
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
 #include "eixTk/stringutils.h"
+#include "eixTk/stringtypes.h"
 #include "eixTk/sysutils.h"
+#include "eixTk/utils.h"
 #include "eixTk/varsreader.h"
 #include "eixrc/eixrc.h"
 
@@ -51,19 +56,49 @@ const EixRc::DelayvarFlags
 	EixRc::DELAYVAR_ESCAPE,
 	EixRc::DELAYVAR_APPEND;
 
+/**
+The first string of a cache file, followed by the format version
+**/
+static const char *cache_magic = "eixrc-cache";
+static const char *cache_version = "1";
+
 static void override_by_env(map<string, string> *m) ATTRIBUTE_NONNULL_;
+static void wide_by_geometry(string *wide) ATTRIBUTE_NONNULL_;
+static string env_value(const char *name) ATTRIBUTE_NONNULL_;
+static string stamp_string(const FileStamps::Stamp& stamp);
+static void cache_put(string *data, const string& s) ATTRIBUTE_NONNULL_;
+static void cache_put_count(string *data, string::size_type count) ATTRIBUTE_NONNULL_;
+static bool cache_get(const string& data, string::size_type *pos, string *s) ATTRIBUTE_NONNULL_;
+static bool cache_get_count(const string& data, string::size_type *pos, string::size_type *count) ATTRIBUTE_NONNULL_;
+
+/**
+The strings of the table of defaults contain the context of those
+messages which are to be translated (see P_ in eixrc/globals.h)
+**/
+#ifdef ENABLE_NLS
+static const char *translate_default(const char *s) ATTRIBUTE_NONNULL_;
+static const char *translate_default(const char *s) {
+	const char *msgid(std::strchr(s, EIX_GETTEXT_CONTEXT_GLUE[0]));
+	if(likely(msgid == NULLPTR)) {
+		return s;
+	}
+	return eix::pgettext_aux(s, msgid + 1);
+}
+#else
+#define translate_default(s) (s)
+#endif
 
-EixRcOption::EixRcOption(OptionType t, string name, string val, string desc) {
-	type = t;
-	key = name;
+EixRcOption::EixRcOption(OptionType t, const string& name, const string& val) : type(t), key(name), description("") {
 	if(type == LOCAL) {
 		local_value = val;
 	} else {
 		value = val;
-		description = desc;
 	}
 }
 
+EixRcOption::EixRcOption(const EixRcDefault& d) : type(d.type), key(d.key), value(translate_default(d.value)), description(d.description) {
+}
+
 eix::SignedBool EixRc::getBoolText(const string& key, const char *text) {
 	const string& s((*this)[key]);
 	if(casecontains(s, text)) {
@@ -176,7 +211,7 @@ const char *EixRc::prefix_cstr(const string& key) const {
 	return NULLPTR;
 }
 
-void EixRc::read() {
+void EixRc::init_eprefixconf() {
 	const char *name("EIX_PREFIX");
 	const char *eixrc_prefix(getenv(name));
 	if(eixrc_prefix) {
@@ -192,6 +227,39 @@ void EixRc::read() {
 		}
 	}
 	modify_value(&m_eprefixconf, name);
+}
+
+void EixRc::read() {
+	init_eprefixconf();
+	string cachefile(cache_name());
+	WordVec key;
+	if(!cachefile.empty()) {
+		cache_key(&key);
+		if(read_cache(cachefile, key)) {
+			from_cache = true;
+			m_eprefixconf = (*this)["PORTAGE_CONFIGROOT"];
+			return;
+		}
+	}
+	FileStamps stamps;
+	FileStamps *recorder(FileStamps::recorder);
+	FileStamps::recorder = &stamps;
+	read_uncached();
+	FileStamps::recorder = recorder;
+	if(!cachefile.empty() && !stamps.unreliable()) {
+		write_cache(cachefile, key, stamps);
+	}
+}
+
+void EixRc::read_uncached() {
+	defaults.clear();
+	prefix_keys.clear();
+	for(DefaultTables::const_iterator it(default_tables.begin());
+		likely(it != default_tables.end()); ++it) {
+		for(default_index i(0); likely(i != it->second); ++i) {
+			addDefault(EixRcOption(it->first[i]));
+		}
+	}
 
 	set<string> has_delayed;
 
@@ -207,6 +275,216 @@ void EixRc::read() {
 	m_eprefixconf = (*this)["PORTAGE_CONFIGROOT"];
 }
 
+/**
+The cache is stored in $EIXRC_CACHE (default ${XDG_CACHE_HOME:-~/.cache}/eix)
+in a file depending on varprefix, since the variables with * refer to it.
+Without $HOME there is no cache, since the warning must be repeated.
+**/
+string EixRc::cache_name() const {
+	string name;
+	const char *home(getenv("HOME"));
+	if(unlikely(home == NULLPTR)) {
+		return name;
+	}
+	const char *dir(getenv("EIXRC_CACHE"));
+	if(dir != NULLPTR) {
+		name = dir;
+		if(name.empty()) {
+			return name;
+		}
+	} else {
+		dir = getenv("XDG_CACHE_HOME");
+		if((dir != NULLPTR) && (*dir == '/')) {
+			name = dir;
+		} else {
+			name = home;
+			name.append("/.cache");
+		}
+		name.append("/eix");
+	}
+	name.append("/eixrc-");
+	for(string::const_iterator it(varprefix.begin());
+		likely(it != varprefix.end()); ++it) {
+		if(*it != '_') {
+			name.append(1, my_tolower(*it));
+		}
+	}
+	return name;
+}
+
+/**
+Besides the files which were read (whose stamps are stored separately),
+the variables depend on the defaults, on varprefix, and on the environment
+variables used to find the files.
+**/
+void EixRc::cache_key(WordVec *key) const {
+	default_index count(0);
+	for(DefaultTables::const_iterator it(default_tables.begin());
+		likely(it != default_tables.end()); ++it) {
+		count += it->second;
+	}
+	key->push_back(PACKAGE_VERSION);
+	key->push_back(eix::format("%s") % count);
+	key->push_back(varprefix);
+	key->push_back(m_eprefixconf);
+	key->push_back(env_value("EIXRC"));
+	key->push_back(env_value("HOME"));
+}
+
+/**
+A cache file which cannot be read (e.g. of an older format)
+is silently ignored; it is replaced when the cache is written.
+**/
+bool EixRc::read_cache(const string& filename, const WordVec& key) {
+	string data, s;
+	string::size_type pos(0), count;
+	if(unlikely(!(read_file_buffer(filename.c_str(), &data) &&
+		cache_get(data, &pos, &s) && (s == cache_magic) &&
+		cache_get(data, &pos, &s) && (s == cache_version) &&
+		cache_get_count(data, &pos, &count) &&
+		(count == key.size())))) {
+		return false;
+	}
+	for(WordVec::const_iterator it(key.begin()); likely(it != key.end()); ++it) {
+		if(unlikely(!(cache_get(data, &pos, &s) && (s == *it)))) {
+			return false;
+		}
+	}
+	if(unlikely(!cache_get_count(data, &pos, &count))) {
+		return false;
+	}
+	for(; likely(count != 0); --count) {
+		string name;
+		FileStamps::Stamp current;
+		if(unlikely(!(cache_get(data, &pos, &name) &&
+			cache_get(data, &pos, &s)))) {
+			return false;
+		}
+		FileStamps::get_stamp(name.c_str(), &current);
+		if(s != stamp_string(current)) {
+			return false;
+		}
+	}
+	if(unlikely(!cache_get(data, &pos, &s))) {
+		return false;
+	}
+	if(!s.empty()) {
+		string wide;
+		wide_by_geometry(&wide);
+		if(s.compare(1, string::npos, wide) != 0) {
+			return false;
+		}
+	}
+	if(unlikely(!cache_get_count(data, &pos, &count))) {
+		return false;
+	}
+	for(; likely(count != 0); --count) {
+		string name;
+		if(unlikely(!(cache_get(data, &pos, &name) &&
+			cache_get(data, &pos, &s) &&
+			(s == env_value(name.c_str()))))) {
+			return false;
+		}
+	}
+	my_map resolved, fromfile;
+	for(my_map *m(&resolved); ; m = &fromfile) {
+		if(unlikely(!cache_get_count(data, &pos, &count))) {
+			return false;
+		}
+		for(; likely(count != 0); --count) {
+			string name;
+			if(unlikely(!(cache_get(data, &pos, &name) &&
+				cache_get(data, &pos, &((*m)[name]))))) {
+				return false;
+			}
+		}
+		if(m == &fromfile) {
+			break;
+		}
+	}
+	main_map.swap(resolved);
+	filevarmap.swap(fromfile);
+	return true;
+}
+
+/**
+Stored are the resolved variables, and those variables from the files
+which might be needed later for add_later_variable.
+The cache is written into a temporary file which then replaces the
+old one; errors are silently ignored.
+**/
+void EixRc::write_cache(const string& filename, const WordVec& key, const FileStamps& stamps) const {
+	string data;
+	cache_put(&data, cache_magic);
+	cache_put(&data, cache_version);
+	cache_put_count(&data, key.size());
+	for(WordVec::const_iterator it(key.begin()); likely(it != key.end()); ++it) {
+		cache_put(&data, *it);
+	}
+	cache_put_count(&data, stamps.stamps.size());
+	for(FileStamps::Stamps::const_iterator it(stamps.stamps.begin());
+		likely(it != stamps.stamps.end()); ++it) {
+		cache_put(&data, it->first);
+		cache_put(&data, stamp_string(it->second));
+	}
+	if(wide_from_geometry) {
+		my_map::const_iterator wide(filevarmap.find("WIDETERM"));
+		cache_put(&data, string("=") + wide->second);
+	} else {
+		cache_put(&data, "");
+	}
+	WordSet names;
+	for(my_map::const_iterator it(main_map.begin()); likely(it != main_map.end()); ++it) {
+		names.insert(it->first);
+	}
+	WordVec fromfile;
+	for(my_map::const_iterator it(filevarmap.begin()); likely(it != filevarmap.end()); ++it) {
+		if(names.insert(it->first).second) {
+			fromfile.push_back(it->first);
+		}
+	}
+	cache_put_count(&data, names.size());
+	for(WordSet::const_iterator it(names.begin()); likely(it != names.end()); ++it) {
+		cache_put(&data, *it);
+		cache_put(&data, env_value(it->c_str()));
+	}
+	cache_put_count(&data, main_map.size());
+	for(my_map::const_iterator it(main_map.begin()); likely(it != main_map.end()); ++it) {
+		cache_put(&data, it->first);
+		cache_put(&data, it->second);
+	}
+	cache_put_count(&data, fromfile.size());
+	for(WordVec::const_iterator it(fromfile.begin()); likely(it != fromfile.end()); ++it) {
+		cache_put(&data, *it);
+		cache_put(&data, filevarmap.find(*it)->second);
+	}
+
+	string::size_type slash(filename.rfind('/'));
+	if(likely((slash != string::npos) && (slash != 0))) {
+		string dir(filename, 0, slash);
+		if(mkdir(dir.c_str(), 0700) != 0) {
+			slash = dir.rfind('/');
+			if((slash != string::npos) && (slash != 0)) {
+				mkdir(dir.substr(0, slash).c_str(), 0700);
+				mkdir(dir.c_str(), 0700);
+			}
+		}
+	}
+	string tmpname(eix::format("%s.%s") % filename % getpid());
+	FILE *fp(fopen(tmpname.c_str(), "wb"));
+	if(unlikely(fp == NULLPTR)) {
+		return;
+	}
+	bool ok(fwrite(data.c_str(), 1, data.size(), fp) == data.size());
+	if(unlikely(fclose(fp) != 0)) {
+		ok = false;
+	}
+	if(likely(ok) && likely(rename(tmpname.c_str(), filename.c_str()) == 0)) {
+		return;
+	}
+	unlink(tmpname.c_str());
+}
+
 const string& EixRc::operator[](const string& key) {
 	my_map::const_iterator it(main_map.find(key));
 	if(it != main_map.end())
@@ -391,6 +669,83 @@ string *EixRc::resolve_delayed_recurse(const string& key, set<string> *visited,
 	}
 }
 
+/**
+@return the value of an environment variable with a leading "=",
+or the empty string if it is not set
+**/
+static string env_value(const char *name) {
+	const char *val(getenv(name));
+	if(val == NULLPTR) {
+		return "";
+	}
+	return string("=") + val;
+}
+
+static string stamp_string(const FileStamps::Stamp& stamp) {
+	return eix::format("%s %s") % stamp.mtime % stamp.link;
+}
+
+static void cache_put(string *data, const string& s) {
+	data->append(eix::format("%s:") % s.size());
+	data->append(s);
+}
+
+static void cache_put_count(string *data, string::size_type count) {
+	cache_put(data, eix::format("%s") % count);
+}
+
+/**
+Each string of the cache is stored as its decimal length, a colon,
+and the string itself
+**/
+static bool cache_get(const string& data, string::size_type *pos, string *s) {
+	string::size_type i(*pos), len(0);
+	for(;; ++i) {
+		if(unlikely(i >= data.size())) {
+			return false;
+		}
+		char c(data[i]);
+		if(c == ':') {
+			break;
+		}
+		if(unlikely((c < '0') || (c > '9'))) {
+			return false;
+		}
+		len = 10 * len + (c - '0');
+	}
+	++i;
+	if(unlikely(len > data.size() - i)) {
+		return false;
+	}
+	s->assign(data, i, len);
+	*pos = i + len;
+	return true;
+}
+
+static bool cache_get_count(const string& data, string::size_type *pos, string::size_type *count) {
+	string s;
+	if(unlikely(!cache_get(data, pos, &s) || s.empty())) {
+		return false;
+	}
+	*count = 0;
+	for(string::const_iterator it(s.begin()); likely(it != s.end()); ++it) {
+		if(unlikely((*it < '0') || (*it > '9'))) {
+			return false;
+		}
+		*count = 10 * (*count) + (*it - '0');
+	}
+	return true;
+}
+
+static void wide_by_geometry(string *wide) {
+	unsigned int lines, columns;
+	if(get_geometry(&lines, &columns)) {
+		*wide = ((columns > 80) ? "true" : "false");
+	} else {
+		wide->clear();
+	}
+}
+
 static void override_by_env(map<string, string> *m) {
 	for(map<string, string>::iterator it(m->begin()); likely(it != m->end()); ++it) {
 		char *val(getenv((it->first).c_str()));
@@ -456,12 +811,8 @@ void EixRc::read_undelayed(set<string> *has_delayed) {
 	if(wide.empty() || (wide == "auto")) {
 		string& c(filevarmap["COLUMNS"]);
 		if(c.empty() || (c == "auto")) {
-			unsigned int lines, columns;
-			if(get_geometry(&lines, &columns)) {
-				wide = ((columns > 80) ? "true" : "false");
-			} else {
-				wide.clear();
-			}
+			wide_by_geometry(&wide);
+			wide_from_geometry = true;
 		} else {
 			wide = ((my_atoi(c.c_str()) > 80) ? "true" : "false");
 		}
@@ -512,7 +863,7 @@ void EixRc::join_key(const string& key, set<string> *has_delayed, bool add_top_t
 
 	if(unlikely(add_top_to_defaults)) {
 		if(unlikely((exclude_defaults == NULLPTR) || (exclude_defaults->find(key) == exclude_defaults->end())))
-			defaults.push_back(EixRcOption(EixRcOption::LOCAL, key, *val, ""));
+			defaults.push_back(EixRcOption(EixRcOption::LOCAL, key, *val));
 	}
 	join_key_rec(key, *val, has_delayed, exclude_defaults);
 }
@@ -687,17 +1038,22 @@ void EixRc::modify_value(string *value, const string& key) {
 }
 
 void EixRc::clear() {
+	from_cache = false;
 	defaults.clear();
 	prefix_keys.clear();
 	filevarmap.clear();
 	main_map.clear();
 }
 
-void EixRc::addDefault(EixRcOption option) {
+void EixRc::addDefaults(const EixRcDefault *table, default_index count) {
+	default_tables.push_back(DefaultTables::value_type(table, count));
+}
+
+void EixRc::addDefault(const EixRcOption& option) {
 	if(unlikely(option.type == EixRcOption::PREFIXSTRING))
 		prefix_keys.insert(option.key);
-	modify_value(&(option.value), option.key);
 	defaults.push_back(option);
+	modify_value(&(defaults.back().value), option.key);
 }
 
 bool EixRc::istrue(const char *s) {
@@ -783,6 +1139,14 @@ string EixRc::as_comment(const string& s) {
 }
 
 void EixRc::dumpDefaults(FILE *s, bool use_defaults) {
+	if(unlikely(from_cache)) {
+		// The cache contains only the resolved variables
+		from_cache = false;
+		main_map.clear();
+		filevarmap.clear();
+		init_eprefixconf();
+		read_uncached();
+	}
 	string message(use_defaults ?
 		_("was locally changed to:") :
 		_("changed locally, default was:"));
@@ -826,7 +1190,7 @@ void EixRc::dumpDefaults(FILE *s, bool use_defaults) {
 				"# %s\n"
 				"%s=\"%s\"\n",
 				as_comment(typestring).c_str(),
-				as_comment(defaults[i].description.c_str()).c_str(),
+				as_comment(translate_default(defaults[i].description)).c_str(),
 				key,
 				output.c_str());
 		if(deflt == value) {
@@ -21,6 +21,7 @@
 #include "eixTk/constexpr.h"
 #include "eixTk/eixint.h"
 #include "eixTk/inttypes.h"
+#include "eixTk/stringtypes.h"
 #include "portage/keywords.h"
 #include "search/redundancy.h"
 
@@ -29,30 +30,59 @@
 #define UPDATE_VARS_PREFIX "UPDATE_"
 #define DROP_VARS_PREFIX "DROP_"
 
+class EixRcDefault;
+class FileStamps;
+
 class EixRcOption {
 	public:
 		typedef enum { STRING, PREFIXSTRING, INTEGER, BOOLEAN, LOCAL } OptionType;
 		OptionType type;
-		std::string key, value, local_value, description;
+		std::string key, value, local_value;
+
+		/**
+		The description from the table of defaults (not yet translated)
+		**/
+		const char *description;
 
-		EixRcOption(OptionType t, std::string name, std::string val, std::string desc);
+		EixRcOption(OptionType t, const std::string& name, const std::string& val);
+
+		explicit EixRcOption(const EixRcDefault& d);
+};
+
+/**
+An entry of the static table of defaults in eixrc/global?.cc.
+Strings which are translated contain their context (see P_ in globals.h);
+they are translated only when they are needed.
+**/
+class EixRcDefault {
+	public:
+		EixRcOption::OptionType type;
+		const char *key, *value, *description;
 };
 
 class EixRc {
 	public:
 		std::string m_eprefixconf;
 
-		explicit EixRc(const char *prefix) ATTRIBUTE_NONNULL_ : varprefix(prefix) {
+		explicit EixRc(const char *prefix) ATTRIBUTE_NONNULL_ : varprefix(prefix), from_cache(false), wide_from_geometry(false) {
 		}
 
 		typedef std::vector<EixRcOption>::size_type default_index;
 		typedef std::pair<RedAtom, RedAtom> RedPair;
 
+		/**
+		Read the variables; if possible, the resolved variables
+		are taken from the cache (see EIXRC_CACHE)
+		**/
 		void read();
 
 		void clear();
 
-		void addDefault(EixRcOption option);
+		/**
+		Add a part of the static table of defaults;
+		its entries are used only if the cache cannot be used
+		**/
+		void addDefaults(const EixRcDefault *table, default_index count) ATTRIBUTE_NONNULL_;
 
 		bool getBool(const std::string& key) {
 			return istrue((*this)[key].c_str());
@@ -88,6 +118,14 @@ class EixRc {
 		my_map filevarmap;
 		std::vector<EixRcOption> defaults;
 		std::set<std::string> prefix_keys;
+		typedef std::vector<std::pair<const EixRcDefault *, default_index> > DefaultTables;
+		DefaultTables default_tables;
+
+		/**
+		from_cache: main_map was read from the cache, so defaults is empty.
+		wide_from_geometry: WIDETERM was calculated from the terminal.
+		**/
+		bool from_cache, wide_from_geometry;
 
 		enum DelayedType { DelayedNotFound, DelayedVariable, DelayedIfTrue, DelayedIfFalse, DelayedIfNonempty, DelayedIfEmpty, DelayedElse, DelayedFi, DelayedQuote };
 
@@ -96,6 +134,31 @@ class EixRc {
 
 		void modify_value(std::string *value, const std::string& key);
 
+		void addDefault(const EixRcOption& option);
+
+		/**
+		Set m_eprefixconf from the environment
+		**/
+		void init_eprefixconf();
+
+		/**
+		Read the files and resolve all variables, ignoring the cache
+		**/
+		void read_uncached();
+
+		/**
+		@return the name of the cache file or the empty string
+		**/
+		std::string cache_name() const;
+
+		/**
+		The data which must be unchanged for the cache to be valid
+		**/
+		void cache_key(WordVec *key) const ATTRIBUTE_NONNULL_;
+
+		bool read_cache(const std::string& filename, const WordVec& key);
+		void write_cache(const std::string& filename, const WordVec& key, const FileStamps& stamps) const;
+
 		/**
 		This will fetch a variable which was not set in the
 		defaults (or its modification or its delayed references),
@@ -23,12 +23,12 @@ EixRc& get_eixrc(const char *varprefix) {
 	eix_assert_static(static_eixrc == NULLPTR);
 	static_eixrc = new EixRc(varprefix);
 
-	fill_defaults_part_1(static_eixrc);
-	fill_defaults_part_2(static_eixrc);
-	fill_defaults_part_3(static_eixrc);
-	fill_defaults_part_4(static_eixrc);
-	fill_defaults_part_5(static_eixrc);
-	fill_defaults_part_6(static_eixrc);
+	static_eixrc->addDefaults(default_options_1, default_options_1_size);
+	static_eixrc->addDefaults(default_options_2, default_options_2_size);
+	static_eixrc->addDefaults(default_options_3, default_options_3_size);
+	static_eixrc->addDefaults(default_options_4, default_options_4_size);
+	static_eixrc->addDefaults(default_options_5, default_options_5_size);
+	static_eixrc->addDefaults(default_options_6, default_options_6_size);
 
 	static_eixrc->read();
 	return *static_eixrc;
@@ -10,7 +10,7 @@
 #ifndef SRC_EIXRC_GLOBAL_H_
 #define SRC_EIXRC_GLOBAL_H_ 1
 
-class EixRc;
+#include "eixrc/eixrc.h"
 
 /**
 Must be called exactly once before get_eixrc() can be used
@@ -22,11 +22,20 @@ EixRc& get_eixrc(const char *varprefix) ATTRIBUTE_NONNULL_;
 **/
 EixRc& get_eixrc() ATTRIBUTE_PURE;
 
-void fill_defaults_part_1(EixRc *eixrc) ATTRIBUTE_NONNULL_;
-void fill_defaults_part_2(EixRc *eixrc) ATTRIBUTE_NONNULL_;
-void fill_defaults_part_3(EixRc *eixrc) ATTRIBUTE_NONNULL_;
-void fill_defaults_part_4(EixRc *eixrc) ATTRIBUTE_NONNULL_;
-void fill_defaults_part_5(EixRc *eixrc) ATTRIBUTE_NONNULL_;
-void fill_defaults_part_6(EixRc *eixrc) ATTRIBUTE_NONNULL_;
+/**
+The parts of the static table of defaults and their sizes
+**/
+extern const EixRcDefault default_options_1[];
+extern const EixRcDefault default_options_2[];
+extern const EixRcDefault default_options_3[];
+extern const EixRcDefault default_options_4[];
+extern const EixRcDefault default_options_5[];
+extern const EixRcDefault default_options_6[];
+extern const EixRc::default_index default_options_1_size;
+extern const EixRc::default_index default_options_2_size;
+extern const EixRc::default_index default_options_3_size;
+extern const EixRc::default_index default_options_4_size;
+extern const EixRc::default_index default_options_5_size;
+extern const EixRc::default_index default_options_6_size;
 
 #endif  // SRC_EIXRC_GLOBAL_H_
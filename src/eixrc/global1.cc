@@ -13,6 +13,8 @@
 
 #define DEFAULT_PART 1
 
-void fill_defaults_part_1(EixRc *eixrc) {
+const EixRcDefault default_options_1[] = {
 #include "eixrc/defaults.cc"  // NOLINT(build/include)
-}
+};
+
+const EixRc::default_index default_options_1_size(sizeof(default_options_1) / sizeof(default_options_1[0]));
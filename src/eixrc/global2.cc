@@ -13,6 +13,8 @@
 
 #define DEFAULT_PART 2
 
-void fill_defaults_part_2(EixRc *eixrc) {
+const EixRcDefault default_options_2[] = {
 #include "eixrc/defaults.cc"  // NOLINT(build/include)
-}
+};
+
+const EixRc::default_index default_options_2_size(sizeof(default_options_2) / sizeof(default_options_2[0]));
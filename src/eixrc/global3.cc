@@ -13,6 +13,8 @@
 
 #define DEFAULT_PART 3
 
-void fill_defaults_part_3(EixRc *eixrc) {
+const EixRcDefault default_options_3[] = {
 #include "eixrc/defaults.cc"  // NOLINT(build/include)
-}
+};
+
+const EixRc::default_index default_options_3_size(sizeof(default_options_3) / sizeof(default_options_3[0]));
@@ -13,6 +13,8 @@
 
 #define DEFAULT_PART 4
 
-void fill_defaults_part_4(EixRc *eixrc) {
+const EixRcDefault default_options_4[] = {
 #include "eixrc/defaults.cc"  // NOLINT(build/include)
-}
+};
+
+const EixRc::default_index default_options_4_size(sizeof(default_options_4) / sizeof(default_options_4[0]));
@@ -13,6 +13,8 @@
 
 #define DEFAULT_PART 5
 
-void fill_defaults_part_5(EixRc *eixrc) {
+const EixRcDefault default_options_5[] = {
 #include "eixrc/defaults.cc"  // NOLINT(build/include)
-}
+};
+
+const EixRc::default_index default_options_5_size(sizeof(default_options_5) / sizeof(default_options_5[0]));
@@ -13,7 +13,9 @@
 
 #define DEFAULT_PART 6
 
-void fill_defaults_part_6(EixRc *eixrc) {
+const EixRcDefault default_options_6[] = {
 #include "eixrc/defaults.cc"  // NOLINT(build/include)
 #include "eixrc/def_i18n.cc"  // NOLINT(build/include)
-}
+};
+
+const EixRc::default_index default_options_6_size(sizeof(default_options_6) / sizeof(default_options_6[0]));
@@ -32,7 +32,13 @@
 #endif
 
 #define AddOption(opt_type, opt_name, opt_default, opt_description) \
-	eixrc->addDefault(EixRcOption(EixRcOption::opt_type, opt_name, \
-		opt_default, opt_description))
+	{ EixRcOption::opt_type, opt_name, opt_default, opt_description },
+
+// The table contains only the message ids with their context;
+// they are translated by EixRc when they are used.
+#ifdef ENABLE_NLS
+#undef P_
+#define P_(p, a) p EIX_GETTEXT_CONTEXT_GLUE a
+#endif
 
 #endif  // SRC_EIXRC_GLOBALS_H_
@@ -71,6 +71,7 @@ bool CascadingProfile::addProfile(const char *profile, WordSet *sourced_files) {
 	if(unlikely(topcall)) {
 		sourced_files = new WordSet;
 	} else if(sourced_files->find(truename) != sourced_files->end()) {
+		FileStamps::fail();
 		cerr << _("Recursion level for cascading profiles exceeded; stopping reading parents") << endl;
 		return false;
 	}
@@ -105,6 +106,7 @@ bool CascadingProfile::addProfile(const char *profile, WordSet *sourced_files) {
 				path = repos.get_path(repo);
 			}
 			if(path == NULLPTR) {
+				FileStamps::fail();
 				cerr << eix::format(_("warning: ignoring parent %s of file %s"))
 					% (*it) % currfile << endl;
 				continue;
@@ -56,6 +56,7 @@ Access to the cascading profile pointed to by /etc/make.profile
 **/
 class CascadingProfile {
 		friend class ProfileFilenames;
+		friend class SettingsSnapshot;
 	public:
 		bool print_profile_paths;
 		std::string profile_paths_append;
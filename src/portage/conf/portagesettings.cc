@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 
+#include "database/settings_snapshot.h"
 #include "eixTk/assert.h"
 #include "eixTk/constexpr.h"
 #include "eixTk/diagnostics.h"
@@ -171,6 +172,7 @@ void PortageSettings::read_config(const string& name, const string& prefix) {
 	configfile.setPrefix(prefix);
 	string errtext;
 	if(unlikely(!configfile.read(name.c_str(), &errtext, true))) {
+		FileStamps::fail();
 		cerr << errtext << endl;
 	}
 }
@@ -196,25 +198,45 @@ void PortageSettings::add_repo_vector(const WordVec& v, bool resolve) {
 }
 
 /**
-Read make.globals and make.conf
+Variables of eixrc and of the environment which are used by read_profiles()
 **/
-void PortageSettings::init(EixRc *eixrc, bool getlocal, bool init_world, bool print_profile_paths) {
-	settings_rc = eixrc;
-#ifndef HAVE_SETENV
-	export_portdir_overlay = false;
-#endif
-	know_upgrade_policy = know_expands = false;
-	m_recurse_sets    = eixrc->getBool("RECURSIVE_SETS");
-	m_eprefixconf     = eixrc->m_eprefixconf;
-	m_eprefix         = (*eixrc)["EPREFIX"];
-	m_eprefixprofile  = (*eixrc)["EPREFIX_PORTAGE_PROFILE"];
-	m_eprefixportdir  = (*eixrc)["EPREFIX_PORTDIR"];
-	m_eprefixoverlays = (*eixrc)["EPREFIX_OVERLAYS"];
-	m_eprefixaccessoverlays = (*eixrc)["EPREFIX_ACCESS_OVERLAYS"];
+static const char *snapshot_rc_vars[] = {
+	"EPREFIX",
+	"EPREFIX_PORTDIR",
+	"EPREFIX_OVERLAYS",
+	"EPREFIX_ACCESS_OVERLAYS",
+	"EPREFIX_SOURCE",
+	"DEFAULT_ARCH",
+	"MAKE_GLOBALS",
+	"PORTAGE_REPOS_CONF",
+	NULLPTR
+};
+
+void PortageSettings::snapshot_key(EixRc *eixrc, WordVec *key) const {
+	key->push_back(PACKAGE_VERSION);
+	key->push_back(m_eprefixconf);
+	for(const char **var(snapshot_rc_vars); likely(*var != NULLPTR); ++var) {
+		key->push_back(string(*var) + "=" + (*eixrc)[*var]);
+	}
+	for(const char **var(test_in_env_early); likely(*var != NULLPTR); ++var) {
+		const char *e(getenv(*var));
+		if(e == NULLPTR) {
+			key->push_back(*var);
+		} else {
+			key->push_back(string(*var) + "=" + e);
+		}
+	}
+}
+
+/**
+Read make.globals, make.conf, repos.conf, and the profiles
+**/
+bool PortageSettings::read_profiles(EixRc *eixrc, bool getlocal, bool print_profile_paths, CascadingProfile **local_profile_ret) {
 	(*this)["ARCH"]   = (*eixrc)["DEFAULT_ARCH"];
 
 	const string& eprefixsource((*eixrc)["EPREFIX_SOURCE"]);
 	const string& make_globals((*eixrc)["MAKE_GLOBALS"]);
+	FileStamps::record(make_globals.c_str());
 	if(is_file(make_globals.c_str())) {
 		read_config(make_globals, eprefixsource);
 	} else {
@@ -311,41 +333,16 @@ void PortageSettings::init(EixRc *eixrc, bool getlocal, bool init_world, bool pr
 		join_to_string(&ref, overlayvec, "\n");
 	}
 
-	user_config = NULLPTR;
-	profile = new CascadingProfile(this, init_world);
-	if(unlikely(print_profile_paths)) {
-		profile->print_profile_paths = true;
-		string& s(profile->profile_paths_append);
-		s = (*eixrc)["PRINT_APPEND"];
-		unescape_string(&s);
-	}
-	store_world_sets(NULLPTR);
-	bool read_world(false);
-	if(init_world) {
-		if(eixrc->getBool("SAVE_WORLD"))
-			read_world = true;
-	} else {
-		if(eixrc->getBool("CURRENT_WORLD"))
-			read_world = true;
-	}
-	if(read_world) {
-		if(profile->m_world.add_file((*eixrc)["EIX_WORLD"].c_str(), Mask::maskInWorld, false)) {
-			profile->use_world = true;
-		}
-		profile->m_world.finalize();
-		read_world_sets((*eixrc)["EIX_WORLD_SETS"].c_str());
-	}
-
 	string& my_path((*this)["PORTDIR"]);
 	profile->listaddFile(my_path + PORTDIR_MASK_FILE, 0, false);
 	profile->listaddFile(my_path + PORTDIR_UNMASK_FILE, 0, false);
 	profile->listaddProfile();
 	if(unlikely(print_profile_paths)) {
-		return;
+		return false;
 	}
 	profile->readMakeDefaults();
 	profile->readremoveFiles();
-	CascadingProfile *local_profile(NULLPTR);
+	CascadingProfile *&local_profile(*local_profile_ret);
 	if(getlocal) {
 		local_profile = new CascadingProfile(*profile);
 	}
@@ -375,6 +372,67 @@ void PortageSettings::init(EixRc *eixrc, bool getlocal, bool init_world, bool pr
 			erase("USE");
 		}
 	}
+	return true;
+}
+
+/**
+Read make.globals and make.conf
+**/
+void PortageSettings::init(EixRc *eixrc, bool getlocal, bool init_world, bool print_profile_paths) {
+	settings_rc = eixrc;
+#ifndef HAVE_SETENV
+	export_portdir_overlay = false;
+#endif
+	know_upgrade_policy = know_expands = false;
+	m_recurse_sets    = eixrc->getBool("RECURSIVE_SETS");
+	m_eprefixconf     = eixrc->m_eprefixconf;
+	m_eprefix         = (*eixrc)["EPREFIX"];
+	m_eprefixprofile  = (*eixrc)["EPREFIX_PORTAGE_PROFILE"];
+	m_eprefixportdir  = (*eixrc)["EPREFIX_PORTDIR"];
+	m_eprefixoverlays = (*eixrc)["EPREFIX_OVERLAYS"];
+	m_eprefixaccessoverlays = (*eixrc)["EPREFIX_ACCESS_OVERLAYS"];
+	user_config = NULLPTR;
+	profile = new CascadingProfile(this, init_world);
+	if(unlikely(print_profile_paths)) {
+		profile->print_profile_paths = true;
+		string& s(profile->profile_paths_append);
+		s = (*eixrc)["PRINT_APPEND"];
+		unescape_string(&s);
+	}
+	store_world_sets(NULLPTR);
+	bool read_world(false);
+	if(init_world) {
+		if(eixrc->getBool("SAVE_WORLD"))
+			read_world = true;
+	} else {
+		if(eixrc->getBool("CURRENT_WORLD"))
+			read_world = true;
+	}
+	if(read_world) {
+		if(profile->m_world.add_file((*eixrc)["EIX_WORLD"].c_str(), Mask::maskInWorld, false)) {
+			profile->use_world = true;
+		}
+		profile->m_world.finalize();
+		read_world_sets((*eixrc)["EIX_WORLD_SETS"].c_str());
+	}
+
+	CascadingProfile *local_profile(NULLPTR);
+	const string& snapshot((*eixrc)["EIX_SETTINGS_SNAPSHOT"]);
+	if(getlocal && !print_profile_paths && !snapshot.empty()) {
+		WordVec key;
+		snapshot_key(eixrc, &key);
+		if(!SettingsSnapshot::read(snapshot, key, this, &local_profile)) {
+			FileStamps stamps;
+			FileStamps::recorder = &stamps;
+			read_profiles(eixrc, getlocal, false, &local_profile);
+			FileStamps::recorder = NULLPTR;
+			if(!stamps.unreliable()) {
+				SettingsSnapshot::write(snapshot, key, stamps, this, local_profile, NULLPTR);
+			}
+		}
+	} else if(unlikely(!read_profiles(eixrc, getlocal, print_profile_paths, &local_profile))) {
+		return;
+	}
 
 	override_by_env(test_in_env_late);
 
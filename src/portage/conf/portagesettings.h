@@ -156,6 +156,7 @@ class PortageSettings : public std::map<std::string, std::string> {
 	private:
 		friend class CascadingProfile;
 		friend class PortageUserConfig;
+		friend class SettingsSnapshot;
 
 		typedef WordMap my_map;
 
@@ -199,6 +200,20 @@ class PortageSettings : public std::map<std::string, std::string> {
 		void override_by_env(const char **vars) ATTRIBUTE_NONNULL_;
 		void read_config(const std::string& name, const std::string& prefix);
 
+		/**
+		Read make.conf, repos.conf, and the profiles.
+		Only the variables, repos, and the PreLists of the profiles
+		are set here, so that this can be replaced by SettingsSnapshot.
+		@return false if only the profile paths were printed
+		**/
+		bool read_profiles(EixRc *eixrc, bool getlocal, bool print_profile_paths, CascadingProfile **local_profile) ATTRIBUTE_NONNULL((2, 5));
+
+		/**
+		The settings of eixrc and the environment on which
+		the result of read_profiles() depends
+		**/
+		void snapshot_key(EixRc *eixrc, WordVec *key) const ATTRIBUTE_NONNULL_;
+
 		void addOverlayProfiles(CascadingProfile *p) const ATTRIBUTE_NONNULL_;
 
 		void calc_recursive_sets(Package *p) const ATTRIBUTE_NONNULL_;
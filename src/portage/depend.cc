@@ -11,12 +11,14 @@
 
 #include "eixTk/constexpr.h"
 #include "eixTk/likely.h"
+#include "eixTk/null.h"
 #include "eixTk/stringutils.h"
 #include "portage/depend.h"
 
 using std::string;
 
 bool Depend::use_depend;
+bool Depend::use_ids;
 
 const char Depend::c_depend[] = "${DEPEND}";
 const char Depend::c_rdepend[] = "${RDEPEND}";
@@ -66,7 +68,11 @@ void Depend::set(const string& depend, const string& rdepend, const string& pdep
 	}
 	subst_the_same(&m_depend, m_rdepend) || \
 		subst_the_same(&m_rdepend, m_depend);
-	obsolete = false;
+	m_depend_ids.clear();
+	m_rdepend_ids.clear();
+	m_pdepend_ids.clear();
+	m_hdepend_ids.clear();
+	obsolete = have_ids = false;
 }
 
 string Depend::subst(const string& in, const string& text, bool obs) {
@@ -89,6 +95,26 @@ string Depend::subst(const string& in, const string& text, bool obs) {
 	return ret;
 }
 
+bool Depend::atom_key(string *key, const string& word) {
+	string::size_type start(word.find_first_not_of("<>=~"));
+	if((start == string::npos) || (word[start] == '!') || (word[word.size() - 1] == '?')) {
+		return false;
+	}
+	string::size_type end(word.find_first_of(":[", start));
+	key->assign(word, start, (end == string::npos) ? string::npos : (end - start));
+	if(start != 0) {
+		const char *name(key->c_str());
+		const char *version(ExplodeAtom::get_start_of_version(name, true));
+		if(version == NULLPTR) {
+			return false;
+		}
+		key->erase(static_cast<string::size_type>(version - 1 - name));
+	}
+	string::size_type slash(key->find('/'));
+	return ((slash != string::npos) && (slash != 0) && (slash + 1 != key->size()) &&
+		(key->find('/', slash + 1) == string::npos));
+}
+
 bool Depend::operator==(const Depend& d) const {
 	return ((get_depend() == d.get_depend()) &&
 		(get_rdepend() == d.get_rdepend()) &&
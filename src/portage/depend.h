@@ -9,6 +9,9 @@
 #define SRC_PORTAGE_DEPEND_H_ 1
 
 #include <string>
+#include <vector>
+
+#include "eixTk/stringtypes.h"
 
 class Database;
 class DBHeader;
@@ -18,9 +21,16 @@ class PackageTree;
 class Depend {
 	friend class Database;
 
+	public:
+		/**
+		Indices of the words in the depend_hash of the database
+		**/
+		typedef std::vector<WordVec::size_type> WordIds;
+
 	private:
 		std::string m_depend, m_rdepend, m_pdepend, m_hdepend;
-		bool obsolete;
+		WordIds m_depend_ids, m_rdepend_ids, m_pdepend_ids, m_hdepend_ids;
+		bool obsolete, have_ids;
 
 		static const char c_depend[];
 		static const char c_rdepend[];
@@ -30,7 +40,12 @@ class Depend {
 	public:
 		static bool use_depend;
 
-		Depend() : obsolete(false) {
+		/**
+		Keep the word indices when reading from the database
+		**/
+		static bool use_ids;
+
+		Depend() : obsolete(false), have_ids(false) {
 		}
 
 		void set(const std::string& depend, const std::string& rdepend, const std::string& pdepend, const std::string& hdepend, bool normspace);
@@ -67,6 +82,31 @@ class Depend {
 			return m_hdepend;
 		}
 
+		/**
+		@return true if the word indices of the database are known.
+		The word " in the indices of DEPEND (RDEPEND) stands for the
+		words of RDEPEND (DEPEND), see get_depend() and get_rdepend().
+		**/
+		bool known_ids() const {
+			return have_ids;
+		}
+
+		const WordIds& depend_ids() const {
+			return m_depend_ids;
+		}
+
+		const WordIds& rdepend_ids() const {
+			return m_rdepend_ids;
+		}
+
+		const WordIds& pdepend_ids() const {
+			return m_pdepend_ids;
+		}
+
+		const WordIds& hdepend_ids() const {
+			return m_hdepend_ids;
+		}
+
 		bool depend_empty() const {
 			return m_depend.empty();
 		}
@@ -92,8 +132,19 @@ class Depend {
 			m_rdepend.clear();
 			m_pdepend.clear();
 			m_hdepend.clear();
-			obsolete = false;
-		}
+			m_depend_ids.clear();
+			m_rdepend_ids.clear();
+			m_pdepend_ids.clear();
+			m_hdepend_ids.clear();
+			obsolete = have_ids = false;
+		}
+
+		/**
+		Get category/name of the package which the dependency word
+		refers to, e.g. dev-libs/openssl from >=dev-libs/openssl-1.0:=
+		@return false if word is no atom or a blocker
+		**/
+		static bool atom_key(std::string *key, const std::string& word) ATTRIBUTE_NONNULL_;
 
 		bool operator==(const Depend& d) const;
 
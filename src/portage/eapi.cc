@@ -12,6 +12,7 @@
 
 #include "eixTk/assert.h"
 #include "eixTk/likely.h"
+#include "eixTk/mutex.h"
 #include "eixTk/null.h"
 #include "eixTk/stringtypes.h"
 #include "portage/eapi.h"
@@ -23,6 +24,11 @@ typedef map<string, Eapi::EapiIndex> EapiMap;
 static WordVec *eapi_vec(NULLPTR);
 static EapiMap *eapi_map(NULLPTR);
 
+/**
+eix-update may parse versions in several threads
+**/
+static eix::Mutex eapi_mutex;
+
 void Eapi::init_static() {
 	eix_assert_static(eapi_vec == NULLPTR);
 	eapi_map = new EapiMap;
@@ -33,6 +39,7 @@ void Eapi::init_static() {
 
 void Eapi::assign(const std::string& str) {
 	eix_assert_static(eapi_map != NULLPTR);
+	eix::MutexLocker locker(&eapi_mutex);
 	EapiMap::const_iterator it(eapi_map->find(str));
 	if(likely(it != eapi_map->end())) {
 		eapi_index = it->second;
@@ -44,5 +51,6 @@ void Eapi::assign(const std::string& str) {
 
 string Eapi::get() const {
 	eix_assert_static(eapi_vec != NULLPTR);
+	eix::MutexLocker locker(&eapi_mutex);
 	return (*eapi_vec)[eapi_index];
 }
@@ -266,6 +266,8 @@ the result looks like this
 This corresponds to portage's sorting.
 **/
 class PreList : public std::vector<PreListEntry> {
+		friend class SettingsSnapshot;
+
 	public:
 		typedef PreListEntry::FilenameIndex FilenameIndex;
 		typedef PreListEntry::LineNumber LineNumber;
@@ -128,6 +128,11 @@ class Package : public eix::ptr_list<Version> {
 		mutable since it is just a cache.
 		**/
 		mutable bool allow_upgrade_slots, know_upgrade_slots;
+
+		/**
+		Levenshtein distance of the last fuzzy test matching this package
+		**/
+		unsigned int fuzzy_distance;
 		bool calc_allow_upgrade_slots(const PortageSettings *ps) const ATTRIBUTE_NONNULL_;
 
 		const SlotList& slotlist() const {
@@ -505,6 +510,7 @@ class Package : public eix::ptr_list<Version> {
 			have_duplicate_versions = DUP_NONE;
 			version_collects = COLLECT_DEFAULT;
 			local_collects.set(MaskFlags::MASK_NONE);
+			fuzzy_distance = 0;
 		}
 };
 
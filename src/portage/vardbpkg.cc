@@ -21,6 +21,7 @@
 #include "eixTk/eixint.h"
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
+#include "eixTk/stats.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/stringutils.h"
 #include "eixTk/sysutils.h"
@@ -168,18 +169,28 @@ bool VarDbPkg::readOverlay(const Package& p, InstVersion *v, const DBHeader& hea
 	return false;
 }
 
-string VarDbPkg::readOverlayLabel(const Package *p, const BasicVersion *v) const {
-	LineVec lines;
+bool VarDbPkg::read_lines(const Package& p, const BasicVersion *v, VarDbSnapshot::VarDbFile file, LineVec *lines) const {
+	StatsTimer timer(Stats::PHASE_VARDB);
+	string dir(p.name);
+	dir.append(1, '-');
+	dir.append(v->getFull());
 	string dirname(m_directory);
-	dirname.append(p->category);
+	dirname.append(p.category);
 	dirname.append(1, '/');
-	dirname.append(p->name);
-	dirname.append(1, '-');
-	dirname.append(v->getFull());
-	pushback_lines((dirname + "/repository").c_str(),
-		&lines, false, false, 1);
-	pushback_lines((dirname + "/REPOSITORY").c_str(),
-		&lines, false, false, 1);
+	dirname.append(dir);
+	if(m_snapshot != NULLPTR) {
+		return m_snapshot->read_lines(dirname, p.category, dir, file, lines);
+	}
+	dirname.append(1, '/');
+	dirname.append(VarDbSnapshot::file_names[file]);
+	Stats::count(Stats::VARDB_FILES);
+	return pushback_lines(dirname.c_str(), lines, false, false, 1);
+}
+
+string VarDbPkg::readOverlayLabel(const Package *p, const BasicVersion *v) const {
+	LineVec lines;
+	read_lines(*p, v, VarDbSnapshot::FILE_REPOSITORY, &lines);
+	read_lines(*p, v, VarDbSnapshot::FILE_REPOSITORY_UPPER, &lines);
 	if(lines.empty()) {
 		return "";
 	}
@@ -197,9 +208,7 @@ bool VarDbPkg::readSlot(const Package& p, InstVersion *v) const {
 		return false;
 	}
 	LineVec lines;
-	if(unlikely(!pushback_lines(
-		(m_directory + p.category + "/" + p.name + "-" + v->getFull() + "/SLOT").c_str(),
-		&lines, false, false, 1))) {
+	if(unlikely(!read_lines(p, v, VarDbSnapshot::FILE_SLOT, &lines))) {
 		return (v->read_failed = true);
 	}
 	if((lines.empty()) || (lines[0] == "0")) {
@@ -216,9 +225,7 @@ void VarDbPkg::readEapi(const Package& p, InstVersion *v) const {
 	}
 	v->know_eapi = true;
 	LineVec lines;
-	if(unlikely(!pushback_lines(
-		(m_directory + p.category + "/" + p.name + "-" + v->getFull() + "/EAPI").c_str(),
-		&lines, false, false, 1))) {
+	if(unlikely(!read_lines(p, v, VarDbSnapshot::FILE_EAPI, &lines))) {
 		v->eapi.assign("0");
 		return;
 	}
@@ -238,17 +245,14 @@ bool VarDbPkg::readUse(const Package& p, InstVersion *v) const {
 	v->usedUse.clear();
 	WordSet iuse_set;
 	WordVec alluse;
-	string dirname(m_directory + p.category + "/" + p.name + "-" + v->getFull());
 	LineVec lines;
-	if(unlikely(!pushback_lines((dirname + "/IUSE").c_str(),
-		&lines, false, false, 1))) {
+	if(unlikely(!read_lines(p, v, VarDbSnapshot::FILE_IUSE, &lines))) {
 		return false;
 	}
 	join_and_split(&(v->inst_iuse), lines);
 
 	lines.clear();
-	if(unlikely(!pushback_lines((dirname + "/USE").c_str(),
-		&lines, false, false, 1))) {
+	if(unlikely(!read_lines(p, v, VarDbSnapshot::FILE_USE, &lines))) {
 		return false;
 	}
 	join_and_split(&alluse, lines);
@@ -294,10 +298,8 @@ void VarDbPkg::readRestricted(const Package& p, InstVersion *v, const DBHeader&
 			return;
 		}
 	}
-	string dirname(m_directory + p.category + "/" + p.name + "-" + v->getFull());
 	LineVec lines;
-	if(unlikely(!pushback_lines((dirname + "/RESTRICT").c_str(),
-		&lines, false, false, 1))) {
+	if(unlikely(!read_lines(p, v, VarDbSnapshot::FILE_RESTRICT, &lines))) {
 		// It is OK that this file does not exist:
 		// Portage does this if RESTRICT is not set.
 		v->restrictFlags = ExtendedVersion::RESTRICT_NONE;
@@ -315,11 +317,9 @@ void VarDbPkg::readInstDate(const Package& p, InstVersion *v) const {
 		return;
 	}
 	v->know_instDate = true;
-	string dirname(m_directory + p.category + "/" + p.name + "-" + v->getFull());
 	LineVec datelines;
 	if(use_build_time &&
-		pushback_lines((dirname + "/BUILD_TIME").c_str(),
-			&datelines, false, false, 1)) {
+		read_lines(p, v, VarDbSnapshot::FILE_BUILD_TIME, &datelines)) {
 		for(LineVec::const_iterator it(datelines.begin());
 			it != datelines.end(); ++it) {
 			if(likely((v->instDate = my_atois(it->c_str())) != 0)) {
@@ -327,7 +327,11 @@ void VarDbPkg::readInstDate(const Package& p, InstVersion *v) const {
 			}
 		}
 	}
-	if(unlikely(!get_mtime(&(v->instDate), dirname.c_str()))) {
+	string dir(p.name + "-" + v->getFull());
+	string dirname(m_directory + p.category + "/" + dir);
+	if(unlikely(!((m_snapshot != NULLPTR) ?
+		m_snapshot->read_mtime(dirname, p.category, dir, &(v->instDate)) :
+		get_mtime(&(v->instDate), dirname.c_str())))) {
 		v->instDate = 0;
 	}
 }
@@ -349,22 +353,20 @@ void VarDbPkg::readDepend(const Package& p, InstVersion *v, const DBHeader& head
 			return;
 		}
 	}
-	string dirname(m_directory + p.category + "/" + p.name + "-" + v->getFull());
 	WordVec depend(4);
 	depend[0] = v->depend.get_depend();
 	depend[1] = v->depend.get_rdepend();
 	depend[2] = v->depend.get_pdepend();
 	depend[3] = v->depend.get_hdepend();
-	static const char *filenames[4] = {
-		"/DEPEND",
-		"/RDEPEND",
-		"/PDEPEND",
-		"/HDEPEND"
+	static const VarDbSnapshot::VarDbFile files[4] = {
+		VarDbSnapshot::FILE_DEPEND,
+		VarDbSnapshot::FILE_RDEPEND,
+		VarDbSnapshot::FILE_PDEPEND,
+		VarDbSnapshot::FILE_HDEPEND
 	};
 	for(eix::TinyUnsigned i(0); likely(i < 4); ++i) {
 		LineVec lines;
-		if(likely(pushback_lines((dirname + filenames[i]).c_str(),
-			&lines, false, false, 1))) {
+		if(likely(read_lines(p, v, files[i], &lines))) {
 			if(likely(lines.size() == 1)) {
 				depend[i].assign(lines[0]);
 			} else {
@@ -380,26 +382,38 @@ void VarDbPkg::readDepend(const Package& p, InstVersion *v, const DBHeader& head
 Read category from db-directory
 **/
 void VarDbPkg::readCategory(const char *category) {
-	/* Pointer to category DIRectory */
-	DIR *dir_category;
-
-	/* Open category-directory */
+	StatsTimer timer(Stats::PHASE_VARDB);
 	string dir_category_name(m_directory);
 	dir_category_name.append(category);
-	if((dir_category = opendir(dir_category_name.c_str())) == NULLPTR) {
-		installed[category] = NULLPTR;
-		return;
+	WordVec packages;
+	if(m_snapshot != NULLPTR) {
+		if(!m_snapshot->read_category(dir_category_name, category, &packages)) {
+			installed[category] = NULLPTR;
+			return;
+		}
+	} else {
+		/* Pointer to category DIRectory */
+		DIR *dir_category;
+
+		/* Open category-directory */
+		if((dir_category = opendir(dir_category_name.c_str())) == NULLPTR) {
+			installed[category] = NULLPTR;
+			return;
+		}
+		struct dirent *package_entry;  /* current package dirent */
+		/* Cycle through this category */
+		while(likely((package_entry = readdir(dir_category)) != NULLPTR)) {  // NOLINT(runtime/threadsafe_fn)
+			if(package_entry->d_name[0] == '.')
+				continue;  /* Don't want dot-stuff */
+			packages.push_back(package_entry->d_name);
+		}
+		closedir(dir_category);
 	}
-	dir_category_name.append(1, '/');
 	InstVecPkg *category_installed;
 	installed[category] = category_installed = new InstVecPkg;
 
-	struct dirent *package_entry;  /* current package dirent */
-	/* Cycle through this category */
-	while(likely((package_entry = readdir(dir_category)) != NULLPTR)) {  // NOLINT(runtime/threadsafe_fn)
-		if(package_entry->d_name[0] == '.')
-			continue;  /* Don't want dot-stuff */
-		char **aux(ExplodeAtom::split( package_entry->d_name));
+	for(WordVec::const_iterator it(packages.begin()); likely(it != packages.end()); ++it) {
+		char **aux(ExplodeAtom::split(it->c_str()));
 		if(aux == NULLPTR)
 			continue;
 		string errtext;
@@ -414,7 +428,5 @@ void VarDbPkg::readCategory(const char *category) {
 		free(aux[0]);
 		free(aux[1]);
 	}
-	closedir(dir_category);
-	sort_installed(installed[category]);
+	sort_installed(category_installed);
 }
-
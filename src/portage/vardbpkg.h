@@ -14,9 +14,11 @@
 #include <string>
 #include <vector>
 
+#include "database/vardb_snapshot.h"
 #include "eixTk/eixint.h"
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
+#include "eixTk/stringtypes.h"
 #include "portage/basicversion.h"
 #include "portage/instversion.h"
 #include "portage/package.h"
@@ -44,6 +46,16 @@ class VarDbPkg {
 		bool get_slots, care_of_slots, care_of_deps;
 		bool get_restrictions, care_of_restrictions, use_build_time;
 
+		/**
+		If not NULLPTR, the data is read through this snapshot
+		**/
+		VarDbSnapshot *m_snapshot;
+
+		/**
+		Read the lines of a file of the directory of an installed version
+		**/
+		bool read_lines(const Package& p, const BasicVersion *v, VarDbSnapshot::VarDbFile file, LineVec *lines) const ATTRIBUTE_NONNULL_;
+
 		/**
 		Find installed versions of packet "name" in category "category".
 		@return NULLPTR if not found .. else pointer to vector of versions.
@@ -68,16 +80,33 @@ class VarDbPkg {
 			care_of_deps(care_about_deps),
 			get_restrictions(calc_restrictions),
 			care_of_restrictions(care_about_restrictions),
-			use_build_time(build_time) {
+			use_build_time(build_time),
+			m_snapshot(NULLPTR) {
 		}
 
 		~VarDbPkg() {
+			delete m_snapshot;
 			for(InstVecCat::iterator it(installed.begin());
 				likely(it != installed.end()); ++it) {
 				delete it->second;
 			}
 		}
 
+		/**
+		Read the data through a snapshot stored in filename
+		**/
+		void use_snapshot(const std::string& filename) {
+			delete m_snapshot;
+			m_snapshot = new VarDbSnapshot(filename);
+		}
+
+		/**
+		Write the snapshot if one is used and something has changed
+		**/
+		bool write_snapshot(std::string *errtext) {
+			return ((m_snapshot == NULLPTR) || m_snapshot->write(errtext));
+		}
+
 		bool care_slots() const {
 			return care_of_slots;
 		}
@@ -0,0 +1,150 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#include <config.h>
+
+#include <string>
+#include <vector>
+
+#include "eixTk/likely.h"
+#include "search/ahocorasick.h"
+
+using std::string;
+using std::vector;
+
+void AhoCorasick::clear() {
+	m_nodes.assign(1, Node());
+	for(unsigned int c(0); likely(c != 256); ++c) {
+		m_root[c] = 0;
+	}
+}
+
+void AhoCorasick::add(const string& pattern) {
+	Index node(0);
+	for(string::const_iterator it(pattern.begin()); likely(it != pattern.end()); ++it) {
+		unsigned char c(*it);
+		vector<Edge>& edges(m_nodes[node].edges);
+		vector<Edge>::iterator e(edges.begin());
+		for(; (e != edges.end()) && (e->byte < c); ++e) {
+		}
+		if((e != edges.end()) && (e->byte == c)) {
+			node = e->next;
+			continue;
+		}
+		Index next(m_nodes.size());
+		edges.insert(e, Edge(c, next));
+		// Do not use edges from now on: push_back may move it
+		m_nodes.push_back(Node());
+		node = next;
+	}
+	m_nodes[node].terminal = true;
+}
+
+/**
+The nodes are visited in breadth-first order so that the failure link
+of a node is computed before those of its children.
+**/
+void AhoCorasick::prepare() {
+	Node& root(m_nodes[0]);
+	root.output = root.terminal;
+	for(unsigned int c(0); likely(c != 256); ++c) {
+		m_root[c] = 0;
+	}
+	vector<Index> queue;
+	for(vector<Edge>::const_iterator e(root.edges.begin());
+		likely(e != root.edges.end()); ++e) {
+		m_root[e->byte] = e->next;
+		Node& node(m_nodes[e->next]);
+		node.fail = 0;
+		node.output = (node.terminal || root.terminal);
+		queue.push_back(e->next);
+	}
+	for(vector<Index>::size_type i(0); i != queue.size(); ++i) {
+		Index parent(queue[i]);
+		for(vector<Edge>::const_iterator e(m_nodes[parent].edges.begin());
+			likely(e != m_nodes[parent].edges.end()); ++e) {
+			Index fail(step(m_nodes[parent].fail, e->byte));
+			Node& node(m_nodes[e->next]);
+			node.fail = fail;
+			node.output = (node.terminal || m_nodes[fail].output);
+			queue.push_back(e->next);
+		}
+	}
+}
+
+AhoCorasick::Index AhoCorasick::child(Index node, unsigned char c) const {
+	const vector<Edge>& edges(m_nodes[node].edges);
+	for(vector<Edge>::const_iterator e(edges.begin()); e != edges.end(); ++e) {
+		if(e->byte >= c) {
+			return ((e->byte == c) ? e->next : 0);
+		}
+	}
+	return 0;
+}
+
+AhoCorasick::Index AhoCorasick::step(Index node, unsigned char c) const {
+	for(; node != 0; node = m_nodes[node].fail) {
+		Index next(child(node, c));
+		if(next != 0) {
+			return next;
+		}
+	}
+	return m_root[c];
+}
+
+bool AhoCorasick::equal(const char *s) const {
+	Index node(0);
+	for(; *s != '\0'; ++s) {
+		node = child(node, static_cast<unsigned char>(*s));
+		if(node == 0) {
+			return false;
+		}
+	}
+	return m_nodes[node].terminal;
+}
+
+bool AhoCorasick::begins(const char *s) const {
+	Index node(0);
+	for(;; ++s) {
+		if(m_nodes[node].terminal) {
+			return true;
+		}
+		if(*s == '\0') {
+			return false;
+		}
+		node = child(node, static_cast<unsigned char>(*s));
+		if(node == 0) {
+			return false;
+		}
+	}
+}
+
+/**
+After reading s, the state is the longest suffix of s in the trie,
+and each pattern which is a suffix of s is a suffix of that state.
+**/
+bool AhoCorasick::ends(const char *s) const {
+	Index node(0);
+	for(; *s != '\0'; ++s) {
+		node = step(node, static_cast<unsigned char>(*s));
+	}
+	return m_nodes[node].output;
+}
+
+bool AhoCorasick::contains(const char *s) const {
+	Index node(0);
+	if(m_nodes[0].output) {
+		return true;
+	}
+	for(; *s != '\0'; ++s) {
+		node = step(node, static_cast<unsigned char>(*s));
+		if(m_nodes[node].output) {
+			return true;
+		}
+	}
+	return false;
+}
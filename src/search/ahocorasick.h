@@ -0,0 +1,107 @@
+// vim:set noet cinoptions= sw=4 ts=4:
+// This file is part of the eix project and distributed under the
+// terms of the GNU General Public License v2.
+//
+// Copyright (c)
+//   Martin Väth <martin@mvath.de>
+
+#ifndef SRC_SEARCH_AHOCORASICK_H_
+#define SRC_SEARCH_AHOCORASICK_H_ 1
+
+#include <string>
+#include <vector>
+
+/**
+An Aho-Corasick automaton for a set of strings: Testing whether some
+of them occurs in (or starts, ends, or equals) a string needs only
+one pass over that string, independent of the number of patterns.
+After the last add(), prepare() must be called before the tests.
+**/
+class AhoCorasick {
+	public:
+		AhoCorasick() {
+			clear();
+		}
+
+		void clear();
+
+		void add(const std::string& pattern);
+
+		/**
+		Compute the failure links
+		**/
+		void prepare();
+
+		/**
+		@return true if s equals some pattern
+		**/
+		bool equal(const char *s) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+
+		/**
+		@return true if s starts with some pattern
+		**/
+		bool begins(const char *s) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+
+		/**
+		@return true if s ends with some pattern
+		**/
+		bool ends(const char *s) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+
+		/**
+		@return true if s contains some pattern
+		**/
+		bool contains(const char *s) const ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
+
+	private:
+		typedef std::vector<int>::size_type Index;
+
+		class Edge {
+			public:
+				unsigned char byte;
+				Index next;
+
+				Edge(unsigned char c, Index n) : byte(c), next(n) {
+				}
+		};
+
+		class Node {
+			public:
+				/**
+				Sorted by byte
+				**/
+				std::vector<Edge> edges;
+
+				/**
+				The node of the longest proper suffix which is in the trie
+				**/
+				Index fail;
+
+				/**
+				terminal: Some pattern ends here.
+				output: Some pattern is a suffix of this node.
+				**/
+				bool terminal, output;
+
+				Node() : fail(0), terminal(false), output(false) {
+				}
+		};
+
+		std::vector<Node> m_nodes;
+
+		/**
+		The goto function of the root with failures resolved (0 if none)
+		**/
+		Index m_root[256];
+
+		/**
+		@return the child of node for c or 0 if there is none
+		**/
+		Index child(Index node, unsigned char c) const ATTRIBUTE_PURE;
+
+		/**
+		The state after reading c in state node
+		**/
+		Index step(Index node, unsigned char c) const ATTRIBUTE_PURE;
+};
+
+#endif  // SRC_SEARCH_AHOCORASICK_H_
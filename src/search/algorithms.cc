@@ -13,13 +13,17 @@
 
 #include <cstring>
 
-#include <map>
+#include <algorithm>
 #include <string>
+#include <vector>
 
-#include "eixTk/assert.h"
+#include "eixTk/likely.h"
 #include "eixTk/null.h"
+#include "eixTk/regexp.h"
+#include "eixTk/stringtypes.h"
 #include "eixTk/unused.h"
 #include "portage/package.h"
+#include "search/ahocorasick.h"
 #include "search/algorithms.h"
 #include "search/levenshtein.h"
 
@@ -33,56 +37,211 @@ fnmatch(3) tells that this is a GNU extension.
 #define FNMATCH_FLAGS 0
 #endif
 
-using std::map;
 using std::string;
+using std::vector;
 
-typedef map<string, Levenshtein> LevenshteinMap;
-LevenshteinMap *FuzzyAlgorithm::levenshtein_map = NULLPTR;
+using std::pop_heap;
+using std::push_heap;
+using std::sort_heap;
+
+bool FuzzyAlgorithm::have_distances = false;
+bool FuzzyAlgorithm::have_bound = false;
+Levenshtein FuzzyAlgorithm::bound;
 
 void FuzzyAlgorithm::init_static() {
-	eix_assert_static(levenshtein_map == NULLPTR);
-	levenshtein_map = new LevenshteinMap;
+	have_distances = have_bound = false;
 }
 
 bool FuzzyAlgorithm::compare(Package *p1, Package *p2) {
-	return ((*levenshtein_map)[p1->category + "/" + p1->name]
-			< (*levenshtein_map)[p2->category + "/" + p2->name]);
+	return (p1->fuzzy_distance < p2->fuzzy_distance);
 }
 
-
 bool FuzzyAlgorithm::operator()(const char *s, Package *p) {
-	eix_assert_static(levenshtein_map != NULLPTR);
-	Levenshtein d(get_levenshtein_distance(search_string.c_str(), s));
-	bool ok(d <= max_levenshteindistance);
+	Levenshtein max(max_levenshteindistance);
+	if(unlikely(have_bound)) {
+		if(bound == 0) {
+			return false;
+		}
+		if(bound <= max) {
+			max = bound - 1;
+		}
+	}
+	Levenshtein d(pattern.distance(s, max));
+	bool ok(d <= max);
 	if(ok) {
 		if(p != NULLPTR) {
-			(*levenshtein_map)[p->category + "/" + p->name] = d;
+			p->fuzzy_distance = d;
+			have_distances = true;
 		}
 	}
 	return ok;
 }
 
+Package *FuzzyTop::add(Package *p) {
+	Candidate c;
+	c.distance = p->fuzzy_distance;
+	c.number = m_number++;
+	c.package = p;
+	m_heap.push_back(c);
+	push_heap(m_heap.begin(), m_heap.end());
+	Package *dropped(NULLPTR);
+	if(m_heap.size() > m_count) {
+		pop_heap(m_heap.begin(), m_heap.end());
+		dropped = m_heap.back().package;
+		m_heap.pop_back();
+	}
+	if(m_heap.size() == m_count) {
+		// Later packages with the same distance as the worst cannot enter
+		FuzzyAlgorithm::set_bound(m_heap.front().distance);
+	}
+	return dropped;
+}
+
+void FuzzyTop::finish(eix::ptr_list<Package> *matches) {
+	sort_heap(m_heap.begin(), m_heap.end());
+	for(vector<Candidate>::const_iterator it(m_heap.begin());
+		likely(it != m_heap.end()); ++it) {
+		matches->push_back(it->package);
+	}
+	m_heap.clear();
+}
+
+double LiteralAlgorithm::anchor_pass_rate(Anchor a) {
+	switch(a) {
+		case ANCHOR_BOTH:
+			return 0.01;
+		case ANCHOR_BEGIN:
+		case ANCHOR_END:
+			return 0.05;
+		default:
+			return 0.2;
+	}
+}
+
+const char *LiteralAlgorithm::anchor_name(Anchor a) {
+	switch(a) {
+		case ANCHOR_BOTH:
+			return "exact";
+		case ANCHOR_BEGIN:
+			return "begin";
+		case ANCHOR_END:
+			return "end";
+		default:
+			return "substring";
+	}
+}
+
 bool ExactAlgorithm::operator()(const char *s, Package *p ATTRIBUTE_UNUSED) {
 	UNUSED(p);
-	return (strcmp(search_string.c_str(), s) == 0);
+	return matcher.equal(s);
 }
 
 bool BeginAlgorithm::operator()(const char *s, Package *p ATTRIBUTE_UNUSED) {
 	UNUSED(p);
-	return (strncmp(search_string.c_str(), s, search_string.size()) == 0);
+	return matcher.begins(s);
 }
 
 bool EndAlgorithm::operator()(const char *s, Package *p ATTRIBUTE_UNUSED) {
 	UNUSED(p);
-	string::size_type l(strlen(s));
-	string::size_type sl(search_string.size());
-	if(l < sl) {
-		return false;
+	return matcher.ends(s);
+}
+
+bool MultiLiteralAlgorithm::sorted_lookup(bool *exact) const {
+	switch(m_anchor) {
+		case LiteralAlgorithm::ANCHOR_BOTH:
+			*exact = true;
+			return true;
+		case LiteralAlgorithm::ANCHOR_BEGIN:
+			*exact = false;
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool MultiLiteralAlgorithm::literals(vector<WordVec> *alternatives) const {
+	for(WordVec::const_iterator it(m_strings.begin()); likely(it != m_strings.end()); ++it) {
+		alternatives->push_back(WordVec(1, *it));
+	}
+	return true;
+}
+
+double MultiLiteralAlgorithm::pass_rate() const {
+	double rate(LiteralAlgorithm::anchor_pass_rate(m_anchor) * m_strings.size());
+	return ((rate < 1) ? rate : 1);
+}
+
+bool MultiLiteralAlgorithm::operator()(const char *s, Package *p ATTRIBUTE_UNUSED) {
+	UNUSED(p);
+	if(unlikely(!m_prepared)) {
+		m_automaton.prepare();
+		m_prepared = true;
+	}
+	switch(m_anchor) {
+		case LiteralAlgorithm::ANCHOR_BOTH:
+			return m_automaton.equal(s);
+		case LiteralAlgorithm::ANCHOR_BEGIN:
+			return m_automaton.begins(s);
+		case LiteralAlgorithm::ANCHOR_END:
+			return m_automaton.ends(s);
+		// case LiteralAlgorithm::ANCHOR_NONE:
+		default:
+			return m_automaton.contains(s);
 	}
-	return (strcmp(search_string.c_str(), s + (l - sl)) == 0);
 }
 
 bool PatternAlgorithm::operator()(const char *s, Package *p ATTRIBUTE_UNUSED) {
 	UNUSED(p);
 	return (fnmatch(search_string.c_str(), s, FNMATCH_FLAGS) == 0);
 }
+
+static void push_run(WordVec *words, string *run) ATTRIBUTE_NONNULL_;
+static void push_run(WordVec *words, string *run) {
+	if(!run->empty()) {
+		words->push_back(*run);
+		run->clear();
+	}
+}
+
+bool RegexAlgorithm::literals(vector<WordVec> *alternatives) const {
+	return Regex::literals(search_string, alternatives);
+}
+
+bool PatternAlgorithm::literals(vector<WordVec> *alternatives) const {
+	const string& s(search_string);
+	WordVec words;
+	string run;
+	for(string::size_type i(0); likely(i < s.size()); ++i) {
+		switch(s[i]) {
+			case '*':
+			case '?':
+				push_run(&words, &run);
+				break;
+			case '[':
+				{
+					push_run(&words, &run);
+					// An unterminated [ is an ordinary character
+					string::size_type end(skip_bracket(s, i, true));
+					if(end != string::npos) {
+						i = end;
+					}
+				}
+				break;
+			case '\\':
+				if(i + 1 < s.size()) {
+					run.append(1, s[++i]);
+				}
+				break;
+			default:
+				run.append(1, s[i]);
+				break;
+		}
+	}
+	push_run(&words, &run);
+	if(words.empty()) {
+		return false;
+	}
+	alternatives->push_back(WordVec());
+	alternatives->back().swap(words);
+	return true;
+}
@@ -10,13 +10,21 @@
 #ifndef SRC_SEARCH_ALGORITHMS_H_
 #define SRC_SEARCH_ALGORITHMS_H_ 1
 
-#include <map>
 #include <string>
+#include <vector>
 
+#include "eixTk/eixint.h"
+#include "eixTk/null.h"
+#include "eixTk/ptr_list.h"
 #include "eixTk/regexp.h"
+#include "eixTk/stringmatch.h"
+#include "eixTk/stringtypes.h"
 #include "eixTk/unused.h"
+#include "search/ahocorasick.h"
 #include "search/levenshtein.h"
 
+class LiteralAlgorithm;
+class MultiLiteralAlgorithm;
 class Package;
 class matchtree;
 
@@ -37,7 +45,180 @@ class BaseAlgorithm {
 			// Nothin' to see here, please move along
 		}
 
+		const std::string& getString() const {
+			return search_string;
+		}
+
+		/**
+		Append all search strings; usually this is only search_string
+		**/
+		virtual void getStrings(WordVec *strings) const ATTRIBUTE_NONNULL_ {
+			strings->push_back(search_string);
+		}
+
+		virtual LiteralAlgorithm *as_literal() {
+			return NULLPTR;
+		}
+
+		virtual MultiLiteralAlgorithm *as_multi_literal() {
+			return NULLPTR;
+		}
+
+		/**
+		Can the matching strings be looked up in a sorted list?
+		@return true if exactly the strings equal to search_string
+		(*exact = true) or starting with search_string (*exact = false) match
+		**/
+		virtual bool sorted_lookup(bool *exact ATTRIBUTE_UNUSED) const ATTRIBUTE_NONNULL_ {
+			UNUSED(exact);
+			return false;
+		}
+
+		/**
+		Which strings must occur (up to case) in a matching string?
+		@return false if this is unknown; otherwise each matching string
+		contains all entries of at least one member of *alternatives
+		**/
+		virtual bool literals(std::vector<WordVec> *alternatives ATTRIBUTE_UNUSED) const ATTRIBUTE_NONNULL_ {
+			UNUSED(alternatives);
+			return false;
+		}
+
+		/**
+		Estimated cost of one call of operator() relative to a
+		literal comparison; used to order the tests
+		**/
+		virtual double cost() const {
+			return 4;
+		}
+
+		/**
+		Estimated fraction of the strings which match
+		**/
+		virtual double pass_rate() const {
+			return 0.2;
+		}
+
+		/**
+		@return false if operator() stores data in the package so that
+		it matters whether operator() is called at all
+		**/
+		virtual bool stateless() const {
+			return true;
+		}
+
 		virtual bool operator()(const char *s, Package *p) ATTRIBUTE_NONNULL((2)) = 0;
+
+		/**
+		@return the name of the algorithm as in the option, e.g. for --explain
+		**/
+		virtual const char *name() const = 0;
+
+	protected:
+		/**
+		For algorithms whose matches contain search_string
+		**/
+		bool search_literal(std::vector<WordVec> *alternatives) const ATTRIBUTE_NONNULL_ {
+			alternatives->push_back(WordVec(1, search_string));
+			return true;
+		}
+};
+
+/**
+For algorithms comparing with search_string literally
+**/
+class LiteralAlgorithm : public BaseAlgorithm {
+	public:
+		/**
+		Where search_string must occur in a matching string
+		**/
+		enum Anchor { ANCHOR_NONE, ANCHOR_BEGIN, ANCHOR_END, ANCHOR_BOTH };
+
+	protected:
+		StringMatcher matcher;
+
+	public:
+		void setString(const std::string& s) {
+			search_string = s;
+			matcher.set_pattern(s, false);
+		}
+
+		bool literals(std::vector<WordVec> *alternatives) const ATTRIBUTE_NONNULL_ {
+			return search_literal(alternatives);
+		}
+
+		virtual Anchor anchor() const = 0;
+
+		double cost() const {
+			return 1;
+		}
+
+		double pass_rate() const {
+			return anchor_pass_rate(anchor());
+		}
+
+		static double anchor_pass_rate(Anchor a) ATTRIBUTE_CONST;
+
+		static const char *anchor_name(Anchor a) ATTRIBUTE_CONST;
+
+		const char *name() const {
+			return anchor_name(anchor());
+		}
+
+		LiteralAlgorithm *as_literal() {
+			return this;
+		}
+};
+
+/**
+Several literal algorithms with the same anchor combined by "or":
+An Aho-Corasick automaton tests all strings in one pass.
+**/
+class MultiLiteralAlgorithm : public BaseAlgorithm {
+	protected:
+		LiteralAlgorithm::Anchor m_anchor;
+		WordVec m_strings;
+		AhoCorasick m_automaton;
+		bool m_prepared;
+
+	public:
+		explicit MultiLiteralAlgorithm(LiteralAlgorithm::Anchor anchor)
+			: m_anchor(anchor), m_prepared(false) {
+		}
+
+		void add(const std::string& s) {
+			m_strings.push_back(s);
+			m_automaton.add(s);
+			m_prepared = false;
+		}
+
+		LiteralAlgorithm::Anchor anchor() const {
+			return m_anchor;
+		}
+
+		void getStrings(WordVec *strings) const ATTRIBUTE_NONNULL_ {
+			strings->insert(strings->end(), m_strings.begin(), m_strings.end());
+		}
+
+		bool sorted_lookup(bool *exact) const ATTRIBUTE_NONNULL_;
+
+		bool literals(std::vector<WordVec> *alternatives) const ATTRIBUTE_NONNULL_;
+
+		double cost() const {
+			return 2;
+		}
+
+		double pass_rate() const ATTRIBUTE_PURE;
+
+		MultiLiteralAlgorithm *as_multi_literal() {
+			return this;
+		}
+
+		const char *name() const {
+			return LiteralAlgorithm::anchor_name(m_anchor);
+		}
+
+		bool operator()(const char *s, Package *p ATTRIBUTE_UNUSED) ATTRIBUTE_NONNULL((2));
 };
 
 /**
@@ -60,6 +241,16 @@ class RegexAlgorithm : public BaseAlgorithm {
 			re.compile(search_string.c_str(), REG_ICASE);
 		}
 
+		bool literals(std::vector<WordVec> *alternatives) const ATTRIBUTE_NONNULL_;
+
+		double cost() const {
+			return 8;
+		}
+
+		const char *name() const {
+			return "regex";
+		}
+
 		bool operator()(const char *s, Package *p ATTRIBUTE_UNUSED) ATTRIBUTE_NONNULL((2)) {
 			UNUSED(p);
 			return re.match(s);
@@ -69,35 +260,61 @@ class RegexAlgorithm : public BaseAlgorithm {
 /**
 exact string matching
 **/
-class ExactAlgorithm : public BaseAlgorithm {
+class ExactAlgorithm : public LiteralAlgorithm {
 	public:
+		Anchor anchor() const {
+			return ANCHOR_BOTH;
+		}
+
+		bool sorted_lookup(bool *exact) const ATTRIBUTE_NONNULL_ {
+			*exact = true;
+			return true;
+		}
+
 		bool operator()(const char *s, Package *p ATTRIBUTE_UNUSED) ATTRIBUTE_NONNULL((2)) ATTRIBUTE_PURE;
 };
 
 /**
 substring matching
 **/
-class SubstringAlgorithm : public BaseAlgorithm {
+class SubstringAlgorithm : public LiteralAlgorithm {
 	public:
+		Anchor anchor() const {
+			return ANCHOR_NONE;
+		}
+
 		bool operator()(const char *s, Package *p ATTRIBUTE_UNUSED) ATTRIBUTE_NONNULL((2)) {
 			UNUSED(p);
-			return (std::string(s).find(search_string) != std::string::npos);
+			return matcher.contains(s);
 		}
 };
 
 /**
 begin-of-string matching
 **/
-class BeginAlgorithm : public BaseAlgorithm {
+class BeginAlgorithm : public LiteralAlgorithm {
 	public:
+		Anchor anchor() const {
+			return ANCHOR_BEGIN;
+		}
+
+		bool sorted_lookup(bool *exact) const ATTRIBUTE_NONNULL_ {
+			*exact = false;
+			return true;
+		}
+
 		bool operator()(const char *s, Package *p ATTRIBUTE_UNUSED) ATTRIBUTE_NONNULL((2)) ATTRIBUTE_PURE;
 };
 
 /**
 end-of-string matching
 **/
-class EndAlgorithm : public BaseAlgorithm {
+class EndAlgorithm : public LiteralAlgorithm {
 	public:
+		Anchor anchor() const {
+			return ANCHOR_END;
+		}
+
 		bool operator()(const char *s, Package *p ATTRIBUTE_UNUSED) ATTRIBUTE_NONNULL((2)) ATTRIBUTE_PURE;
 };
 
@@ -110,33 +327,128 @@ class FuzzyAlgorithm : public BaseAlgorithm {
 		Levenshtein max_levenshteindistance;
 
 		/**
-		FIXME: We need to have a package->levenshtein mapping that we can
-		access from the static FuzzyAlgorithm::compare.
-		I really don't know how to do this ..
+		The case-folded search string prepared for the distance computation
 		**/
-		static std::map<std::string, Levenshtein> *levenshtein_map;
+		LevenshteinPattern pattern;
+
+		/**
+		Whether some distance was stored in a package
+		**/
+		static bool have_distances;
+
+		/**
+		If have_bound, only distances less than bound are accepted
+		**/
+		static bool have_bound;
+		static Levenshtein bound;
 
 	public:
 		explicit FuzzyAlgorithm(Levenshtein max) : max_levenshteindistance(max) {
 		}
 
+		void setString(const std::string& s) {
+			search_string = s;
+			pattern.setPattern(s);
+		}
+
+		double cost() const {
+			return 16;
+		}
+
+		double pass_rate() const {
+			return 0.1;
+		}
+
+		bool stateless() const {
+			return false;
+		}
+
 		bool operator()(const char *s, Package *p);
 
-		static bool compare(Package *p1, Package *p2) ATTRIBUTE_NONNULL_;
+		const char *name() const {
+			return "fuzzy";
+		}
+
+		static bool compare(Package *p1, Package *p2) ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
 
 		static bool sort_by_levenshtein() {
-			return (!levenshtein_map->empty());
+			return have_distances;
+		}
+
+		/**
+		Some distance was stored, e.g. by another process
+		**/
+		static void set_have_distances() {
+			have_distances = true;
+		}
+
+		/**
+		Reject distances which are not less than b in all fuzzy tests
+		**/
+		static void set_bound(Levenshtein b) {
+			have_bound = true;
+			bound = b;
 		}
 
 		static void init_static();
 };
 
+/**
+Keep the count best matches (by the distance of fuzzy tests) in a bounded
+heap. Once the heap is full, the bound of FuzzyAlgorithm is tightened
+so that only packages which can enter the heap are accepted at all.
+Among equal distances, the earlier matches are kept.
+**/
+class FuzzyTop {
+	public:
+		explicit FuzzyTop(std::vector<Package *>::size_type count) : m_count(count), m_number(0) {
+		}
+
+		/**
+		Add a matching package
+		@return the package which dropped out of the heap or NULLPTR
+		**/
+		Package *add(Package *p) ATTRIBUTE_NONNULL_;
+
+		/**
+		Append the kept packages to matches, best first
+		**/
+		void finish(eix::ptr_list<Package> *matches) ATTRIBUTE_NONNULL_;
+
+	private:
+		class Candidate {
+			public:
+				Levenshtein distance;
+				eix::Treesize number;
+				Package *package;
+
+				bool operator<(const Candidate& c) const {
+					return ((distance < c.distance) ||
+						((distance == c.distance) && (number < c.number)));
+				}
+		};
+
+		std::vector<Candidate>::size_type m_count;
+		eix::Treesize m_number;
+		std::vector<Candidate> m_heap;
+};
+
 /**
 Use fnmatch to test if the package matches.
 **/
 class PatternAlgorithm : public BaseAlgorithm {
 	public:
+		bool literals(std::vector<WordVec> *alternatives) const ATTRIBUTE_NONNULL_;
+
+		double pass_rate() const {
+			return 0.1;
+		}
+
 		bool operator()(const char *s, Package *p ATTRIBUTE_UNUSED) ATTRIBUTE_NONNULL((2));
+
+		const char *name() const {
+			return "pattern";
+		}
 };
 
 #endif  // SRC_SEARCH_ALGORITHMS_H_
@@ -8,20 +8,21 @@
 
 #include <config.h>
 
-#include <sys/types.h>
-
 #include <cstring>
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
+#include "eixTk/inttypes.h"
 #include "eixTk/likely.h"
 #include "eixTk/stringutils.h"
 #include "search/levenshtein.h"
 
+using std::string;
 using std::vector;
 
-using std::min;
+using std::max;
 
 /**
 Calculates the Levenshtein distance of two strings
@@ -30,47 +31,104 @@ Calculates the Levenshtein distance of two strings
 @return int Levenshtein distance of str_a <> str_b
 **/
 Levenshtein get_levenshtein_distance(const char *str_a, const char *str_b) {
-	size_t n(strlen(str_a));
-	size_t m(strlen(str_b));
-	if(n == 0) {
-		return m;
+	LevenshteinPattern pattern;
+	pattern.setPattern(str_a);
+	// The distance never exceeds the length of the longer string
+	return pattern.distance(str_b, static_cast<Levenshtein>(max(strlen(str_a), strlen(str_b))));
+}
+
+void LevenshteinPattern::setPattern(const string& pattern) {
+	m_pattern.assign(pattern);
+	m_size = m_pattern.size();
+	for(unsigned int c(0); likely(c != 256); ++c) {
+		m_lower[c] = my_tolower(static_cast<char>(c));
+		m_peq[c] = 0;
 	}
-	if(m == 0) {
-		return n;
+	for(string::size_type i(0); likely(i != m_size); ++i) {
+		m_pattern[i] = m_lower[static_cast<unsigned char>(m_pattern[i])];
 	}
-
-	typedef vector<Levenshtein> LevVec;
-	typedef vector<LevVec> LevArr;
-
-	// initialize the matrix' dimensions
-	LevArr matrix(n + 1);
-	matrix[0].resize(m + 1);
-	for(LevArr::size_type i(1); likely(i <= n); ++i) {
-		matrix[i].resize(m + 1);
-		fill(matrix[i].begin(), matrix[i].end(), 0);
+	if(m_size > 64) {
+		return;
 	}
-
-	// fill the 1st column/row with str_a / str_b
-	for(LevArr::size_type i(0); likely(i <= n); ++i) {
-		matrix[i][0] = i;
+	uint64_t lower_peq[256] = { 0 };
+	for(string::size_type i(0); likely(i != m_size); ++i) {
+		lower_peq[static_cast<unsigned char>(m_pattern[i])] |= (static_cast<uint64_t>(1) << i);
 	}
-	for(LevVec::size_type j(0); likely(j <= m); ++j) {
-		matrix[0][j] = j;
+	for(unsigned int c(0); likely(c != 256); ++c) {
+		m_peq[c] = lower_peq[static_cast<unsigned char>(m_lower[c])];
 	}
+}
 
-	// calculate the matrix
-	for(LevArr::size_type i(1); likely(i <= n); ++i) {
-		for(LevVec::size_type j(1); likely(j <= m); ++j) {
-			char ci(my_tolower(str_a[i - 1]));
-			char cj(my_tolower(str_b[j - 1]));
-
-			Levenshtein a(matrix[i - 1][j] + 1);
-			Levenshtein b(matrix[i][j - 1] + 1);
-			Levenshtein c(matrix[i - 1][j - 1] + (ci != cj));
-
-			matrix[i][j] = min(a, min(b, c));
+Levenshtein LevenshteinPattern::distance(const char *s, Levenshtein max) const {
+	string::size_type n(strlen(s));
+	// The distance is at least the difference of the lengths
+	string::size_type diff((n > m_size) ? (n - m_size) : (m_size - n));
+	if(diff > max) {
+		return max + 1;
+	}
+	if(m_size == 0) {
+		return static_cast<Levenshtein>(n);
+	}
+	if(m_size > 64) {
+		return distance_rows(s, n, max);
+	}
+	uint64_t pv(~static_cast<uint64_t>(0)), mv(0);
+	uint64_t high(static_cast<uint64_t>(1) << (m_size - 1));
+	string::size_type score(m_size);
+	for(string::size_type j(0); likely(j != n); ++j) {
+		uint64_t eq(m_peq[static_cast<unsigned char>(s[j])]);
+		uint64_t xv(eq | mv);
+		uint64_t xh((((eq & pv) + pv) ^ pv) | eq);
+		uint64_t ph(mv | ~(xh | pv));
+		uint64_t mh(pv & xh);
+		if((ph & high) != 0) {
+			++score;
+		} else if((mh & high) != 0) {
+			--score;
+		}
+		// The remaining n - j - 1 characters can lower the score only by 1 each
+		if(unlikely(score > max + (n - j - 1))) {
+			return max + 1;
 		}
+		ph = (ph << 1) | 1;
+		mh <<= 1;
+		pv = mh | ~(xv | ph);
+		mv = ph & xv;
 	}
+	return static_cast<Levenshtein>(score);
+}
 
-	return matrix[n][m];
+/**
+The classical algorithm computing the matrix row by row;
+it stops if all entries of a row exceed max
+**/
+Levenshtein LevenshteinPattern::distance_rows(const char *s, string::size_type n, Levenshtein max) const {
+	vector<string::size_type> row(m_size + 1);
+	for(string::size_type i(0); likely(i <= m_size); ++i) {
+		row[i] = i;
+	}
+	for(string::size_type j(1); likely(j <= n); ++j) {
+		char c(m_lower[static_cast<unsigned char>(s[j - 1])]);
+		string::size_type diagonal(row[0]);
+		string::size_type minimum(row[0] = j);
+		for(string::size_type i(1); likely(i <= m_size); ++i) {
+			string::size_type above(row[i]);
+			string::size_type d(diagonal + (m_pattern[i - 1] != c));
+			if(row[i - 1] + 1 < d) {
+				d = row[i - 1] + 1;
+			}
+			if(above + 1 < d) {
+				d = above + 1;
+			}
+			diagonal = above;
+			row[i] = d;
+			if(d < minimum) {
+				minimum = d;
+			}
+		}
+		if(unlikely(minimum > max)) {
+			return max + 1;
+		}
+	}
+	return static_cast<Levenshtein>(row[m_size]);
 }
@@ -9,6 +9,10 @@
 #ifndef SRC_SEARCH_LEVENSHTEIN_H_
 #define SRC_SEARCH_LEVENSHTEIN_H_ 1
 
+#include <string>
+
+#include "eixTk/inttypes.h"
+
 typedef unsigned int Levenshtein;
 
 /**
@@ -20,4 +24,44 @@ Reference: http://www.merriampark.com/ld.htm
 **/
 Levenshtein get_levenshtein_distance(const char *str_a, const char *str_b) ATTRIBUTE_NONNULL_ ATTRIBUTE_PURE;
 
+/**
+Calculates the Levenshtein distances (up to case) of many strings
+to a fixed pattern. For patterns of at most 64 characters the
+bit-parallel algorithm of Myers (in the form of Hyyroe) is used;
+otherwise the rows of the matrix are computed.
+**/
+class LevenshteinPattern {
+	public:
+		LevenshteinPattern() : m_size(0) {
+		}
+
+		void setPattern(const std::string& pattern);
+
+		/**
+		@return the distance of s to the pattern if it is at most max;
+		otherwise some larger number
+		**/
+		Levenshtein distance(const char *s, Levenshtein max) const ATTRIBUTE_NONNULL_;
+
+	private:
+		/**
+		The lowercased pattern
+		**/
+		std::string m_pattern;
+		std::string::size_type m_size;
+
+		/**
+		For each byte the bitmask of the positions of the pattern
+		which are equal to it up to case
+		**/
+		uint64_t m_peq[256];
+
+		/**
+		The lowercase variant of each byte
+		**/
+		char m_lower[256];
+
+		Levenshtein distance_rows(const char *s, std::string::size_type n, Levenshtein max) const ATTRIBUTE_NONNULL_;
+};
+
 #endif  // SRC_SEARCH_LEVENSHTEIN_H_
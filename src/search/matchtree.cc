@@ -9,16 +9,25 @@
 
 #include <config.h>
 
+#include <cstdio>
 #ifdef DEBUG_MATCHTREE
 #include <cstdlib>
 #endif
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <stack>
+#include <string>
+#include <vector>
 
+#include "database/package_index.h"
+#include "database/package_reader.h"
+#include "eixTk/formated.h"
 #include "eixTk/i18n.h"
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
+#include "eixTk/stats.h"
 #include "eixTk/unused.h"
 #include "search/matchtree.h"
 #include "search/packagetest.h"
@@ -28,6 +37,8 @@ using std::cerr;
 using std::cout;
 #endif
 using std::endl;
+using std::string;
+using std::vector;
 
 bool MatchAtom::match(PackageReader *p ATTRIBUTE_UNUSED) {
 	UNUSED(p);
@@ -38,6 +49,15 @@ bool MatchAtom::match(PackageReader *p ATTRIBUTE_UNUSED) {
 	return !m_negate;
 }
 
+bool MatchAtom::select(PackageIndex *index ATTRIBUTE_UNUSED, PackageIndex::Selection *sel) {
+	UNUSED(index);
+	if(!m_negate) {
+		return false;
+	}
+	sel->clear();
+	return true;
+}
+
 MatchAtomOperator::~MatchAtomOperator() {
 	delete m_left;
 	delete m_right;
@@ -74,6 +94,35 @@ bool MatchAtomOperator::match(PackageReader *p) {
 	return is_match;
 }
 
+bool MatchAtomOperator::select(PackageIndex *index, PackageIndex::Selection *sel) {
+	if(m_negate) {
+		return false;
+	}
+	bool have_left((m_left != NULLPTR) && m_left->select(index, sel));
+	if((m_operator == AtomOr) && !have_left) {
+		return false;
+	}
+	PackageIndex::Selection right;
+	if((m_right == NULLPTR) || !m_right->select(index, &right)) {
+		// For AtomAnd, the left selection is good enough
+		return ((m_operator == AtomAnd) && have_left);
+	}
+	if(!have_left) {
+		sel->swap(right);
+		return true;
+	}
+	PackageIndex::Selection left;
+	left.swap(*sel);
+	if(m_operator == AtomAnd) {
+		std::set_intersection(left.begin(), left.end(),
+			right.begin(), right.end(), std::back_inserter(*sel));
+	} else {
+		std::set_union(left.begin(), left.end(),
+			right.begin(), right.end(), std::back_inserter(*sel));
+	}
+	return true;
+}
+
 MatchAtomTest::~MatchAtomTest() {
 #ifndef DEBUG_MATCHTREE
 	delete m_test;
@@ -106,6 +155,16 @@ bool MatchAtomTest::match(PackageReader *p) {
 #endif
 }
 
+/**
+The pipe is only an additional condition, so it need not be considered
+**/
+bool MatchAtomTest::select(PackageIndex *index, PackageIndex::Selection *sel) {
+	if(m_negate || (m_test == NULLPTR)) {
+		return false;
+	}
+	return m_test->select(index, sel);
+}
+
 void MatchAtomTest::set_test(PackageTest *gtest) {
 #ifdef DEBUG_MATCHTREE
 	static int t_count(0);
@@ -121,6 +180,36 @@ void MatchAtomTest::set_test(PackageTest *gtest) {
 #endif
 }
 
+MatchAtomExplain::~MatchAtomExplain() {
+	delete m_atom;
+}
+
+/**
+The time is measured inclusively, i.e. it contains the time of the subtrees
+**/
+bool MatchAtomExplain::match(PackageReader *p) {
+	++m_reached;
+	PackageReader::Attributes before(p->have());
+	double start(Stats::wall());
+	bool is_match(m_atom->match(p));
+	m_time += Stats::wall() - start;
+	PackageReader::Attributes after(p->have());
+	if(after > before) {
+		++m_forced;
+		if(after > m_level) {
+			m_level = after;
+		}
+	}
+	if(is_match) {
+		++m_passed;
+	}
+	return is_match;
+}
+
+bool MatchAtomExplain::select(PackageIndex *index, PackageIndex::Selection *sel) {
+	return m_atom->select(index, sel);
+}
+
 MatchTree::MatchTree(bool default_is_or) {
 	root = piperoot = NULLPTR;
 	default_operator = (default_is_or ? MatchAtomOperator::AtomOr : MatchAtomOperator::AtomAnd);
@@ -138,6 +227,10 @@ bool MatchTree::match(PackageReader *p) {
 	return ((root == NULLPTR) || root->match(p));
 }
 
+bool MatchTree::select(PackageIndex *index, PackageIndex::Selection *sel) {
+	return ((root != NULLPTR) && root->select(index, sel));
+}
+
 void MatchTree::set_pipetest(PackageTest *gtest) {
 	MatchAtomTest *p(new MatchAtomTest);
 	p->set_test(gtest);
@@ -276,11 +369,292 @@ void MatchTree::parse_close() {
 	parse_closeforce();
 }
 
+void MatchTree::collect_chain(MatchAtom *atom, MatchAtomOperator::AtomOperator op, vector<MatchAtom *> *operands) {
+	MatchAtomOperator *o((atom == NULLPTR) ? NULLPTR : atom->as_operator());
+	if((o == NULLPTR) || o->m_negate || (o->m_operator != op)) {
+		operands->push_back(atom);
+		return;
+	}
+	collect_chain(o->m_left, op, operands);
+	collect_chain(o->m_right, op, operands);
+	o->m_left = o->m_right = NULLPTR;
+	delete o;
+}
+
+MatchAtom *MatchTree::build_chain(const vector<MatchAtom *>& operands, MatchAtomOperator::AtomOperator op) {
+	MatchAtom *result(operands[0]);
+	for(vector<MatchAtom *>::size_type i(1); i != operands.size(); ++i) {
+		MatchAtomOperator *o(new MatchAtomOperator(op));
+		o->m_left = result;
+		o->m_right = operands[i];
+		result = o;
+	}
+	return result;
+}
+
+/**
+Since the tests in an "or" chain do not influence each other, they can
+be evaluated in any order. A missing operand means "true" everywhere.
+**/
+MatchAtom *MatchTree::merge_literals(MatchAtom *atom) {
+	MatchAtomOperator *op((atom == NULLPTR) ? NULLPTR : atom->as_operator());
+	if(op == NULLPTR) {
+		return atom;
+	}
+	if(op->m_negate || (op->m_operator != MatchAtomOperator::AtomOr)) {
+		op->m_left = merge_literals(op->m_left);
+		op->m_right = merge_literals(op->m_right);
+		return atom;
+	}
+	vector<MatchAtom *> operands;
+	collect_chain(atom, MatchAtomOperator::AtomOr, &operands);
+	vector<MatchAtom *> kept;
+	vector<MatchAtomTest *> literals;
+	for(vector<MatchAtom *>::const_iterator it(operands.begin());
+		likely(it != operands.end()); ++it) {
+		MatchAtomTest *test(((*it) == NULLPTR) ? NULLPTR : (*it)->as_test());
+		if((test == NULLPTR) || test->m_negate || (test->m_pipe != NULLPTR) ||
+			(test->m_test == NULLPTR)) {
+			kept.push_back(merge_literals(*it));
+			continue;
+		}
+		bool merged(false);
+		for(vector<MatchAtomTest *>::const_iterator lit(literals.begin());
+			likely(lit != literals.end()); ++lit) {
+			if((*lit)->m_test->can_merge(*(test->m_test))) {
+				(*lit)->m_test->merge(*(test->m_test));
+				delete test;
+				merged = true;
+				break;
+			}
+		}
+		if(!merged) {
+			literals.push_back(test);
+			kept.push_back(test);
+		}
+	}
+	return build_chain(kept, MatchAtomOperator::AtomOr);
+}
+
+/**
+Reading the versions is by far the most expensive part
+**/
+double MatchTree::read_cost(PackageReader::Attributes have, PackageReader::Attributes need) {
+	static const double cost[PackageReader::ALL + 1] = { 0, 1, 2, 3, 4, 24, 24, 24 };
+	return ((need > have) ? (cost[need] - cost[have]) : 0);
+}
+
+/**
+Matching a package stops at the first operand of an "and" ("or") chain
+which fails (passes). Assuming that the tests are independent, the
+expected cost is minimal if the operands are sorted by the ratio of their
+cost and the probability that they stop the evaluation. The cost of an
+operand includes reading the package beyond what the previous operands
+have read already, so tests which need the same parts of the package
+tend to be grouped and tests which need little are done first.
+The pipe is not known yet; it is assumed to be cheap and selective.
+**/
+MatchAtom *MatchTree::optimize(MatchAtom *atom, Estimate *estimate) {
+	*estimate = Estimate();
+	if(atom == NULLPTR) {
+		return atom;
+	}
+	MatchAtomOperator *op(atom->as_operator());
+	if(op == NULLPTR) {
+		MatchAtomTest *test(atom->as_test());
+		if(test != NULLPTR) {
+			if(test->m_test != NULLPTR) {
+				test->m_test->estimate(&(estimate->cost), &(estimate->pass));
+				estimate->need = test->m_test->get_need();
+				estimate->fixed = !test->m_test->reorderable();
+			}
+			if(test->m_pipe != NULLPTR) {
+				estimate->cost += 4;
+				estimate->pass *= 0.05;
+			}
+		}
+		if(atom->m_negate) {
+			estimate->pass = 1 - estimate->pass;
+		}
+		return atom;
+	}
+	MatchAtomOperator::AtomOperator type(op->m_operator);
+	bool is_and(type == MatchAtomOperator::AtomAnd);
+	bool negate(op->m_negate);
+	vector<MatchAtom *> operands;
+	collect_chain(op->m_left, type, &operands);
+	collect_chain(op->m_right, type, &operands);
+	op->m_left = op->m_right = NULLPTR;
+	delete op;
+
+	vector<Estimate> estimates(operands.size());
+	for(vector<MatchAtom *>::size_type i(0); i != operands.size(); ++i) {
+		operands[i] = optimize(operands[i], &(estimates[i]));
+		if(estimates[i].fixed) {
+			estimate->fixed = true;
+		}
+	}
+	vector<MatchAtom *> ordered;
+	vector<bool> used(operands.size(), false);
+	PackageReader::Attributes have(PackageReader::NONE);
+	double reach(1);
+	while(ordered.size() != operands.size()) {
+		vector<MatchAtom *>::size_type best(operands.size());
+		double best_cost(0), best_stop(0);
+		for(vector<MatchAtom *>::size_type i(0); i != operands.size(); ++i) {
+			if(used[i]) {
+				continue;
+			}
+			double cost(estimates[i].cost + read_cost(have, estimates[i].need));
+			double stop(is_and ? (1 - estimates[i].pass) : estimates[i].pass);
+			if(best == operands.size()) {
+				best = i;
+				best_cost = cost;
+				best_stop = stop;
+				if(estimate->fixed) {
+					break;
+				}
+				continue;
+			}
+			// cost / stop < best_cost / best_stop
+			if(cost * best_stop < best_cost * stop) {
+				best = i;
+				best_cost = cost;
+				best_stop = stop;
+			}
+		}
+		if(ordered.empty()) {
+			estimate->need = estimates[best].need;
+		}
+		used[best] = true;
+		ordered.push_back(operands[best]);
+		estimate->cost += reach * best_cost;
+		reach *= (1 - best_stop);
+		if(have < estimates[best].need) {
+			have = estimates[best].need;
+		}
+	}
+	// The first operand is read anyway
+	estimate->cost -= read_cost(PackageReader::NONE, estimate->need);
+	estimate->pass = (is_and ? reach : (1 - reach));
+	if(negate) {
+		estimate->pass = 1 - estimate->pass;
+	}
+	MatchAtom *result(build_chain(ordered, type));
+	result->m_negate = negate;
+	return result;
+}
+
+MatchAtom *MatchTree::wrap_explain(MatchAtom *atom) {
+	if(atom == NULLPTR) {
+		return atom;
+	}
+	MatchAtomOperator *op(atom->as_operator());
+	if(op != NULLPTR) {
+		op->m_left = wrap_explain(op->m_left);
+		op->m_right = wrap_explain(op->m_right);
+	}
+	return new MatchAtomExplain(atom);
+}
+
+void MatchTree::explain() {
+	root = wrap_explain(root);
+}
+
+void MatchTree::explain_chain(MatchAtom *atom, MatchAtomOperator::AtomOperator op, vector<MatchAtom *> *operands) {
+	MatchAtomExplain *wrapper((atom == NULLPTR) ? NULLPTR : atom->as_explain());
+	MatchAtomOperator *o((wrapper == NULLPTR) ? NULLPTR : wrapper->m_atom->as_operator());
+	if((o == NULLPTR) || o->m_negate || (o->m_operator != op)) {
+		operands->push_back(atom);
+		return;
+	}
+	explain_chain(o->m_left, op, operands);
+	explain_chain(o->m_right, op, operands);
+}
+
+static const char *level_name(PackageReader::Attributes level) ATTRIBUTE_CONST;
+
+static const char *level_name(PackageReader::Attributes level) {
+	switch(level) {
+		case PackageReader::NONE:        return "none";
+		case PackageReader::NAME:        return "name";
+		case PackageReader::DESCRIPTION: return "description";
+		case PackageReader::HOMEPAGE:    return "homepage";
+		case PackageReader::LICENSE:     return "license";
+		case PackageReader::VERSIONS:    return "versions";
+		default:                         break;
+	}
+	return "all";
+}
+
+/**
+A missing operand means "true"
+**/
+void MatchTree::print_explain(MatchAtom *atom, string::size_type depth) {
+	string indent(2 * depth, ' ');
+	if(atom == NULLPTR) {
+		cerr << indent << "true" << endl;
+		return;
+	}
+	MatchAtomExplain *wrapper(atom->as_explain());
+	MatchAtom *inner((wrapper == NULLPTR) ? atom : wrapper->m_atom);
+	string label(inner->m_negate ? "not " : "");
+	MatchAtomOperator *op(inner->as_operator());
+	MatchAtomTest *test(inner->as_test());
+	vector<MatchAtom *> operands;
+	if(op != NULLPTR) {
+		label.append((op->m_operator == MatchAtomOperator::AtomAnd) ? "and" : "or");
+		explain_chain(op->m_left, op->m_operator, &operands);
+		explain_chain(op->m_right, op->m_operator, &operands);
+	} else if((test != NULLPTR) && (test->m_test != NULLPTR)) {
+		string text;
+		test->m_test->explain(&text);
+		label.append(text);
+	} else {
+		label.append("true");
+	}
+	if((test != NULLPTR) && (test->m_pipe != NULLPTR)) {
+		label.append(" with pipe");
+	}
+	cerr << indent << label;
+	if(wrapper != NULLPTR) {
+		char ms[32];
+		snprintf(ms, sizeof(ms), "%.3f", wrapper->m_time * 1000);
+		cerr << ": " << eix::format(_("reached %s, passed %s"))
+			% wrapper->m_reached % wrapper->m_passed;
+		if(wrapper->m_forced != 0) {
+			cerr << ", " << eix::format(_("reads %s for %s"))
+				% level_name(wrapper->m_level) % wrapper->m_forced;
+		}
+		cerr << ", " << eix::format(_("%s ms")) % ms;
+	}
+	cerr << endl;
+	for(vector<MatchAtom *>::const_iterator it(operands.begin());
+		likely(it != operands.end()); ++it) {
+		print_explain(*it, depth + 1);
+	}
+}
+
+void MatchTree::print_explain() {
+	if(root == NULLPTR) {
+		cerr << _("no tests: all packages match") << endl;
+		return;
+	}
+	print_explain(root, 0);
+}
+
 void MatchTree::end_parse() {
+	bool parsing(!parser_stack.empty());
 	parse_local_negate();
 	while(!parser_stack.empty()) {
 		parse_closeforce();
 	}
+#ifndef DEBUG_MATCHTREE
+	if(parsing) {
+		Estimate estimate;
+		root = optimize(merge_literals(root), &estimate);
+	}
+#endif
 #ifdef DEBUG_MATCHTREE
 	if(root == NULLPTR) {
 		cout << "root=NULLPTR\n";
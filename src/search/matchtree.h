@@ -9,9 +9,15 @@
 #define SRC_SEARCH_MATCHTREE_H_ 1
 
 #include <stack>
+#include <string>
+#include <vector>
 
+#include "database/package_index.h"
+#include "database/package_reader.h"
+#include "eixTk/eixint.h"
 #include "eixTk/null.h"
 
+class MatchAtomExplain;
 class MatchAtomOperator;
 class MatchAtomTest;
 class MatchTree;
@@ -43,6 +49,12 @@ class MatchAtom {
 		**/
 		virtual bool match(PackageReader *p) ATTRIBUTE_PURE;
 
+		/**
+		Collect (recursively) a superset of the matching packages.
+		@return false if the index cannot restrict the packages
+		**/
+		virtual bool select(PackageIndex *index, PackageIndex::Selection *sel) ATTRIBUTE_NONNULL_;
+
 		virtual MatchAtomOperator *as_operator() {
 			return NULLPTR;
 		}
@@ -50,6 +62,10 @@ class MatchAtom {
 		virtual MatchAtomTest *as_test() {
 			return NULLPTR;
 		}
+
+		virtual MatchAtomExplain *as_explain() {
+			return NULLPTR;
+		}
 };
 
 class MatchAtomOperator : public MatchAtom {
@@ -68,6 +84,8 @@ class MatchAtomOperator : public MatchAtom {
 
 		bool match(PackageReader *p);
 
+		bool select(PackageIndex *index, PackageIndex::Selection *sel) ATTRIBUTE_NONNULL_;
+
 		MatchAtomOperator *as_operator() {
 			return this;
 		}
@@ -87,6 +105,8 @@ class MatchAtomTest : public MatchAtom {
 
 		bool match(PackageReader *p);
 
+		bool select(PackageIndex *index, PackageIndex::Selection *sel) ATTRIBUTE_NONNULL_;
+
 		void set_test(PackageTest *gtest);
 
 		MatchAtomTest *as_test() {
@@ -94,6 +114,35 @@ class MatchAtomTest : public MatchAtom {
 		}
 };
 
+/**
+A wrapper of an atom for --explain which counts the packages which reach
+and pass the atom, what the atom reads of them, and the time spent inside
+**/
+class MatchAtomExplain : public MatchAtom {
+		friend class MatchTree;
+	private:
+		MatchAtom *m_atom;
+		eix::UNumber m_reached, m_passed, m_forced;
+		PackageReader::Attributes m_level;
+		double m_time;
+
+	public:
+		explicit MatchAtomExplain(MatchAtom *atom) ATTRIBUTE_NONNULL_
+			: m_atom(atom), m_reached(0), m_passed(0), m_forced(0),
+			m_level(PackageReader::NONE), m_time(0) {
+		}
+
+		~MatchAtomExplain();
+
+		bool match(PackageReader *p);
+
+		bool select(PackageIndex *index, PackageIndex::Selection *sel) ATTRIBUTE_NONNULL_;
+
+		MatchAtomExplain *as_explain() {
+			return this;
+		}
+};
+
 class MatchParseData {
 	public:
 		/**
@@ -165,6 +214,79 @@ class MatchTree {
 		**/
 		void parse_closeforce();
 
+		/**
+		Estimated cost and fraction of passing packages of a subtree
+		**/
+		class Estimate {
+			public:
+				/**
+				The cost of the tests including reading the package
+				beyond what the first test needs
+				**/
+				double cost;
+
+				double pass;
+
+				/**
+				What the first test of the subtree reads of the package
+				**/
+				PackageReader::Attributes need;
+
+				/**
+				Must the tests of the subtree be evaluated as given?
+				**/
+				bool fixed;
+
+				Estimate() : cost(0), pass(1), need(PackageReader::NONE), fixed(false) {
+				}
+		};
+
+		/**
+		Append the operands of the chain of op starting at atom to operands
+		and delete the operators of the chain
+		**/
+		static void collect_chain(MatchAtom *atom, MatchAtomOperator::AtomOperator op, std::vector<MatchAtom *> *operands) ATTRIBUTE_NONNULL((3));
+
+		/**
+		@return the operands combined by a left-nested chain of op
+		**/
+		static MatchAtom *build_chain(const std::vector<MatchAtom *>& operands, MatchAtomOperator::AtomOperator op);
+
+		/**
+		Combine literal string tests for the same fields in "or" chains.
+		@return the replacement for atom
+		**/
+		static MatchAtom *merge_literals(MatchAtom *atom);
+
+		/**
+		@return the cost to read the package beyond have up to need
+		**/
+		static double read_cost(PackageReader::Attributes have, PackageReader::Attributes need) ATTRIBUTE_CONST;
+
+		/**
+		Reorder the operands of "and" and "or" chains such that
+		cheap tests which likely decide the result come first.
+		@return the replacement for atom
+		**/
+		static MatchAtom *optimize(MatchAtom *atom, Estimate *estimate) ATTRIBUTE_NONNULL((2));
+
+		/**
+		Wrap atom and its subtrees into MatchAtomExplain
+		@return the replacement for atom
+		**/
+		static MatchAtom *wrap_explain(MatchAtom *atom);
+
+		/**
+		Append the operands of the chain of op starting at atom to operands
+		(skipping the wrappers of the inner operators of the chain)
+		**/
+		static void explain_chain(MatchAtom *atom, MatchAtomOperator::AtomOperator op, std::vector<MatchAtom *> *operands) ATTRIBUTE_NONNULL((3));
+
+		/**
+		Print atom with its subtrees to stderr
+		**/
+		static void print_explain(MatchAtom *atom, std::string::size_type depth);
+
 	public:
 		explicit MatchTree(bool default_is_or);
 
@@ -172,6 +294,12 @@ class MatchTree {
 
 		bool match(PackageReader *p);
 
+		/**
+		Collect a sorted superset of the matching package numbers.
+		@return false if the index cannot restrict the packages
+		**/
+		bool select(PackageIndex *index, PackageIndex::Selection *sel) ATTRIBUTE_NONNULL_;
+
 		void set_pipetest(PackageTest *gtest);
 
 		void parse_test(PackageTest *gtest, bool with_pipe);
@@ -187,6 +315,17 @@ class MatchTree {
 		void parse_close();
 
 		void end_parse();
+
+		/**
+		Collect the data for print_explain() while matching.
+		Must be called after end_parse().
+		**/
+		void explain();
+
+		/**
+		Print the tree with the data collected since explain() to stderr
+		**/
+		void print_explain();
 };
 
 #endif  // SRC_SEARCH_MATCHTREE_H_
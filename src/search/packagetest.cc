@@ -14,6 +14,8 @@
 #include <string>
 #include <vector>
 
+#include "database/header.h"
+#include "database/package_index.h"
 #include "database/package_reader.h"
 #include "eixTk/assert.h"
 #include "eixTk/eixint.h"
@@ -23,6 +25,7 @@
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
 #include "eixTk/regexp.h"
+#include "eixTk/stringmatch.h"
 #include "eixTk/stringtypes.h"
 #include "eixTk/stringutils.h"
 #include "eixTk/utils.h"
@@ -37,11 +40,11 @@
 #include "portage/mask_list.h"
 #include "portage/package.h"
 #include "portage/vardbpkg.h"
+#include "portage/version.h"
 #include "search/algorithms.h"
 #include "search/nowarn.h"
 #include "search/packagetest.h"
 
-class DBHeader;
 class SetStability;
 
 using std::map;
@@ -124,6 +127,7 @@ PackageTest::PackageTest(VarDbPkg *vdb, PortageSettings *p, const PrintFormat *f
 	test_installed = INS_NONE;
 	test_instability = test_stability_default =
 		test_stability_local = test_stability_nonlocal = STABLE_NONE;
+	depend_mode = DEPEND_UNKNOWN;
 }
 
 PackageTest::~PackageTest() {
@@ -435,6 +439,590 @@ void PackageTest::finalize() {
 		setPattern("");
 	}
 	calculateNeeds();
+	if(((field & DEPS) != NONE) && algorithm->stateless()) {
+		Depend::use_ids = true;
+	}
+}
+
+static bool literal_anchor(BaseAlgorithm *algorithm, LiteralAlgorithm::Anchor *anchor) ATTRIBUTE_NONNULL_;
+static bool literal_anchor(BaseAlgorithm *algorithm, LiteralAlgorithm::Anchor *anchor) {
+	LiteralAlgorithm *literal(algorithm->as_literal());
+	if(literal != NULLPTR) {
+		*anchor = literal->anchor();
+		return true;
+	}
+	MultiLiteralAlgorithm *multi(algorithm->as_multi_literal());
+	if(multi != NULLPTR) {
+		*anchor = multi->anchor();
+		return true;
+	}
+	return false;
+}
+
+bool PackageTest::only_string_test() const {
+	return !(overlay || obsolete || upgrade ||
+		installed || multi_installed ||
+		slotted || multi_slot ||
+		world || worldset ||
+		have_virtual || have_nonvirtual ||
+		dup_versions || dup_packages ||
+		(binarynum != 0) ||
+		(restrictions != ExtendedVersion::RESTRICT_NONE) ||
+		(properties != ExtendedVersion::PROPERTIES_NONE) ||
+		(overlay_list != NULLPTR) || (overlay_only_list != NULLPTR) ||
+		(in_overlay_inst_list != NULLPTR) ||
+		(from_overlay_inst_list != NULLPTR) ||
+		(from_foreign_overlay_inst_list != NULLPTR) ||
+		(marked_list != NULLPTR) ||
+		(test_instability != STABLE_NONE) ||
+		(test_stability_default != STABLE_NONE) ||
+		(test_stability_local != STABLE_NONE) ||
+		(test_stability_nonlocal != STABLE_NONE));
+}
+
+bool PackageTest::can_merge(const PackageTest& other) const {
+	LiteralAlgorithm::Anchor anchor, other_anchor;
+	return ((algorithm != NULLPTR) && (other.algorithm != NULLPTR) &&
+		(field == other.field) &&
+		literal_anchor(algorithm, &anchor) &&
+		literal_anchor(other.algorithm, &other_anchor) &&
+		(anchor == other_anchor) &&
+		only_string_test() && other.only_string_test());
+}
+
+void PackageTest::merge(const PackageTest& other) {
+	MultiLiteralAlgorithm *multi(algorithm->as_multi_literal());
+	if(multi == NULLPTR) {
+		LiteralAlgorithm *literal(algorithm->as_literal());
+		multi = new MultiLiteralAlgorithm(literal->anchor());
+		multi->add(literal->getString());
+		setAlgorithm(multi);
+	}
+	WordVec strings;
+	other.algorithm->getStrings(&strings);
+	for(WordVec::const_iterator it(strings.begin()); likely(it != strings.end()); ++it) {
+		multi->add(*it);
+	}
+}
+
+bool PackageTest::reorderable() const {
+	return ((algorithm == NULLPTR) || algorithm->stateless());
+}
+
+/**
+The numbers are only rough guesses: Fields of the package itself are
+cheap, fields of all versions or of installed versions cost more, and
+tests which need the stability of the versions are the most expensive.
+The conditions of the test are assumed to be independent.
+**/
+void PackageTest::estimate(double *cost, double *pass) const {
+	double c(0), p(1);
+	if(algorithm != NULLPTR) {
+		double fields(0);
+		for(MatchField f(field & (NAME | DESCRIPTION | LICENSE | CATEGORY | CATEGORY_NAME | HOMEPAGE));
+			f != NONE; f &= f - 1) {
+			++fields;
+		}
+		for(MatchField f(field & (EAPI | SLOT | FULLSLOT | IUSE | SET));
+			f != NONE; f &= f - 1) {
+			fields += 4;
+		}
+		for(MatchField f(field & DEPS); f != NONE; f &= f - 1) {
+			fields += 16;
+		}
+		c += fields * algorithm->cost();
+		if((field & (USE_ENABLED | USE_DISABLED | INST_EAPI | INST_SLOT | INST_FULLSLOT | DEPS)) != NONE) {
+			c += 8;
+		}
+		double rate(algorithm->pass_rate() * ((fields < 1) ? 1 : fields));
+		p *= ((rate < 1) ? rate : 1);
+	}
+	if(installed) {
+		c += 8;
+		p *= (multi_installed ? 0.02 : 0.1);
+	}
+	if(slotted || overlay || dup_versions || dup_packages ||
+		(overlay_list != NULLPTR) || (overlay_only_list != NULLPTR) ||
+		(restrictions != ExtendedVersion::RESTRICT_NONE) ||
+		(properties != ExtendedVersion::PROPERTIES_NONE) ||
+		(binarynum != 0)) {
+		c += 2;
+		p *= 0.3;
+	}
+	if((in_overlay_inst_list != NULLPTR) ||
+		(from_overlay_inst_list != NULLPTR) ||
+		(from_foreign_overlay_inst_list != NULLPTR)) {
+		c += 8;
+		p *= 0.1;
+	}
+	if(world || worldset) {
+		c += 2;
+		p *= 0.1;
+	}
+	if(marked_list != NULLPTR) {
+		c += 4;
+		p *= 0.05;
+	}
+	if((test_instability != STABLE_NONE) ||
+		(test_stability_default != STABLE_NONE) ||
+		(test_stability_local != STABLE_NONE) ||
+		(test_stability_nonlocal != STABLE_NONE)) {
+		c += 32;
+		p *= 0.5;
+	}
+	if(upgrade) {
+		c += 64;
+		p *= 0.05;
+	}
+	if(obsolete) {
+		c += 128;
+		p *= 0.05;
+	}
+	*cost = c;
+	*pass = p;
+}
+
+/**
+The names of the fields as in the corresponding options
+**/
+static const struct {
+	PackageTest::MatchField field;
+	const char *name;
+} field_names[] = {
+	{ PackageTest::NAME,          "name" },
+	{ PackageTest::DESCRIPTION,   "description" },
+	{ PackageTest::LICENSE,       "license" },
+	{ PackageTest::CATEGORY,      "category" },
+	{ PackageTest::CATEGORY_NAME, "category-name" },
+	{ PackageTest::HOMEPAGE,      "homepage" },
+	{ PackageTest::IUSE,          "use" },
+	{ PackageTest::USE_ENABLED,   "installed-with-use" },
+	{ PackageTest::USE_DISABLED,  "installed-without-use" },
+	{ PackageTest::EAPI,          "eapi" },
+	{ PackageTest::INST_EAPI,     "installed-eapi" },
+	{ PackageTest::SLOT,          "slot" },
+	{ PackageTest::FULLSLOT,      "fullslot" },
+	{ PackageTest::INST_SLOT,     "installed-slot" },
+	{ PackageTest::INST_FULLSLOT, "installed-fullslot" },
+	{ PackageTest::SET,           "set" },
+	{ PackageTest::DEPEND,        "depend" },
+	{ PackageTest::RDEPEND,       "rdepend" },
+	{ PackageTest::PDEPEND,       "pdepend" },
+	{ PackageTest::HDEPEND,       "hdepend" }
+};
+
+static void explain_stability(WordVec *tests, PackageTest::TestStability what, const char *suffix) {
+	static const struct {
+		PackageTest::TestStability flag;
+		const char *name;
+	} stability_names[] = {
+		{ PackageTest::STABLE_FULL,      "stable" },
+		{ PackageTest::STABLE_TESTING,   "testing" },
+		{ PackageTest::STABLE_NONMASKED, "non-masked" },
+		{ PackageTest::STABLE_SYSTEM,    "system" },
+		{ PackageTest::STABLE_PROFILE,   "profile" }
+	};
+	for(unsigned int i(0); likely(i != sizeof(stability_names) / sizeof(stability_names[0])); ++i) {
+		if((what & stability_names[i].flag) != PackageTest::STABLE_NONE) {
+			tests->push_back(string(stability_names[i].name) + suffix);
+		}
+	}
+}
+
+/**
+The string test is omitted if its only pattern is empty (the default
+if no pattern was given) and there are other tests
+**/
+void PackageTest::explain(string *s) const {
+	s->clear();
+	if(algorithm != NULLPTR) {
+		WordVec strings;
+		algorithm->getStrings(&strings);
+		if(!((strings.size() == 1) && strings[0].empty() && !only_string_test())) {
+			for(unsigned int i(0); likely(i != sizeof(field_names) / sizeof(field_names[0])); ++i) {
+				if((field & field_names[i].field) != NONE) {
+					s->append(s->empty() ? "--" : " --");
+					s->append(field_names[i].name);
+				}
+			}
+			s->append(" --");
+			s->append(algorithm->name());
+			for(WordVec::const_iterator it(strings.begin()); likely(it != strings.end()); ++it) {
+				s->append(" \"");
+				s->append(*it);
+				s->append(1, '"');
+			}
+		}
+	}
+	WordVec tests;
+	if(installed) {
+		tests.push_back(multi_installed ? "multi-installed" : "installed");
+	}
+	if(slotted) {
+		tests.push_back(multi_slot ? "slots" : "slotted");
+	}
+	if(overlay) {
+		tests.push_back("overlay");
+	}
+	if(overlay_list != NULLPTR) {
+		tests.push_back("in-overlay");
+	}
+	if(overlay_only_list != NULLPTR) {
+		tests.push_back("only-in-overlay");
+	}
+	if(have_virtual) {
+		tests.push_back("virtual");
+	}
+	if(have_nonvirtual) {
+		tests.push_back("nonvirtual");
+	}
+	if(in_overlay_inst_list != NULLPTR) {
+		tests.push_back("installed-in-overlay");
+	}
+	if((from_overlay_inst_list != NULLPTR) || (from_foreign_overlay_inst_list != NULLPTR)) {
+		tests.push_back("installed-from-overlay");
+	}
+	if(dup_packages) {
+		tests.push_back("dup-packages");
+	}
+	if(dup_versions) {
+		tests.push_back("dup-versions");
+	}
+	if(restrictions != ExtendedVersion::RESTRICT_NONE) {
+		tests.push_back("restrict");
+	}
+	if(properties != ExtendedVersion::PROPERTIES_NONE) {
+		tests.push_back("properties");
+	}
+	if(binarynum != 0) {
+		tests.push_back("binary");
+	}
+	if(obsolete) {
+		tests.push_back("test-obsolete");
+	}
+	if(marked_list != NULLPTR) {
+		tests.push_back("pipe");
+	}
+	if(world) {
+		tests.push_back(world_only_selected ? "selected" : "world");
+	}
+	if(worldset) {
+		tests.push_back(worldset_only_selected ? "selected-set" : "world-set");
+	}
+	explain_stability(&tests, test_stability_default, "");
+	explain_stability(&tests, test_stability_local, "+");
+	explain_stability(&tests, test_stability_nonlocal, "-");
+	if((test_instability & STABLE_FULL) != STABLE_NONE) {
+		tests.push_back("installed-unstable");
+	}
+	if((test_instability & STABLE_TESTING) != STABLE_NONE) {
+		tests.push_back("installed-testing");
+	}
+	if((test_instability & STABLE_NONMASKED) != STABLE_NONE) {
+		tests.push_back("installed-masked");
+	}
+	if(upgrade) {
+		tests.push_back((upgrade_local_mode == LOCALMODE_LOCAL) ? "upgrade+" :
+			((upgrade_local_mode == LOCALMODE_NONLOCAL) ? "upgrade-" : "upgrade"));
+	}
+	for(WordVec::const_iterator it(tests.begin()); likely(it != tests.end()); ++it) {
+		s->append(s->empty() ? "--" : " --");
+		s->append(*it);
+	}
+	if(s->empty()) {
+		s->assign("true");
+	}
+}
+
+/**
+All other tests are only additional conditions, so only the string test
+restricts the packages: Names are bisected if the algorithm allows
+sorted lookup, and for the fields stored in hashes the algorithm is
+applied to the distinct hash entries to obtain posting lists.
+For description and homepage (and for names which cannot be bisected),
+the trigram index yields candidates which contain the literals required
+by the algorithm.
+**/
+bool PackageTest::select(PackageIndex *index, PackageIndex::Selection *sel) const {
+	if(unlikely(algorithm == NULLPTR) || (field == NONE) ||
+		((field & ~(NAME | CATEGORY | CATEGORY_NAME | DESCRIPTION | HOMEPAGE | LICENSE | IUSE | EAPI | SLOT | FULLSLOT)) != NONE)) {
+		return false;
+	}
+	sel->clear();
+	bool exact;
+	bool sorted(algorithm->sorted_lookup(&exact));
+	MatchField trigram_fields(field & (DESCRIPTION | HOMEPAGE));
+	if((field & (NAME | CATEGORY | CATEGORY_NAME)) != NONE) {
+		WordVec strings;
+		algorithm->getStrings(&strings);
+		if(sorted && !exact) {
+			for(WordVec::const_iterator s(strings.begin()); likely(s != strings.end()); ++s) {
+				if(s->empty()) {
+					return false;
+				}
+			}
+		}
+		if((field & NAME) != NONE) {
+			if(!sorted) {
+				trigram_fields |= NAME;
+			} else {
+				for(WordVec::const_iterator s(strings.begin()); likely(s != strings.end()); ++s) {
+					if(unlikely(!index->select_name(sel, *s, exact))) {
+						return false;
+					}
+				}
+			}
+		}
+		if((field & CATEGORY) != NONE) {
+			if(sorted) {
+				for(WordVec::const_iterator s(strings.begin()); likely(s != strings.end()); ++s) {
+					index->select_category(sel, *s, exact);
+				}
+			} else {
+				const WordVec& categories(index->categories());
+				for(WordVec::const_iterator it(categories.begin());
+					likely(it != categories.end()); ++it) {
+					if((*algorithm)(it->c_str(), NULLPTR)) {
+						index->select_category(sel, *it, true);
+					}
+				}
+			}
+		}
+		if((field & CATEGORY_NAME) != NONE) {
+			if(!sorted) {
+				return false;
+			}
+			for(WordVec::const_iterator s(strings.begin()); likely(s != strings.end()); ++s) {
+				if(unlikely(!index->select_category_name(sel, *s, exact))) {
+					return false;
+				}
+			}
+		}
+	}
+	if(trigram_fields != NONE) {
+		vector<WordVec> alternatives;
+		if(!algorithm->literals(&alternatives)) {
+			return false;
+		}
+		if((trigram_fields & NAME) != NONE) {
+			if(!index->select_trigrams(sel, PackageIndex::TRIGRAM_NAME, alternatives)) {
+				return false;
+			}
+		}
+		if((trigram_fields & DESCRIPTION) != NONE) {
+			if(!index->select_trigrams(sel, PackageIndex::TRIGRAM_DESCRIPTION, alternatives)) {
+				return false;
+			}
+		}
+		if((trigram_fields & HOMEPAGE) != NONE) {
+			if(!index->select_trigrams(sel, PackageIndex::TRIGRAM_HOMEPAGE, alternatives)) {
+				return false;
+			}
+		}
+	}
+	if((field & LICENSE) != NONE) {
+		if(!select_hash(index, sel, PackageIndex::POSTING_LICENSE, header->license_hash, LICENSE)) {
+			return false;
+		}
+	}
+	if((field & IUSE) != NONE) {
+		if(!select_hash(index, sel, PackageIndex::POSTING_IUSE, header->iuse_hash, IUSE)) {
+			return false;
+		}
+	}
+	if((field & EAPI) != NONE) {
+		if(!select_hash(index, sel, PackageIndex::POSTING_EAPI, header->eapi_hash, EAPI)) {
+			return false;
+		}
+	}
+	if((field & SLOT) != NONE) {
+		if(!select_hash(index, sel, PackageIndex::POSTING_SLOT, header->slot_hash, SLOT)) {
+			return false;
+		}
+	}
+	if((field & FULLSLOT) != NONE) {
+		if(!select_hash(index, sel, PackageIndex::POSTING_SLOT, header->slot_hash, FULLSLOT)) {
+			return false;
+		}
+	}
+	PackageIndex::normalize(sel);
+	return true;
+}
+
+/**
+Add the posting lists of all entries of hash which match for the field
+which. The entries are translated to the form in which stringMatch()
+passes them to the algorithm.
+@return false if there is no restriction
+**/
+bool PackageTest::select_hash(PackageIndex *index, PackageIndex::Selection *sel, PackageIndex::PostingType type, const StringHash& hash, MatchField which) const {
+	vector<eix::UNumber> ids;
+	for(StringHash::size_type i(0); likely(i != hash.size()); ++i) {
+		const string& entry(hash[i]);
+		bool is_match;
+		if(which == IUSE) {
+			is_match = (*algorithm)(IUse(entry).name().c_str(), NULLPTR);
+		} else if((which & (SLOT | FULLSLOT)) != NONE) {
+			ExtendedVersion v;
+			v.set_slotname(entry);
+			is_match = (*algorithm)(((which == SLOT) ? v.get_longslot() : v.get_longfullslot()).c_str(), NULLPTR);
+		} else {
+			is_match = (*algorithm)(entry.c_str(), NULLPTR);
+		}
+		if(is_match) {
+			ids.push_back(i);
+		}
+	}
+	if(ids.size() == hash.size()) {
+		return false;
+	}
+	return index->select_postings(sel, type, ids);
+}
+
+static bool is_ascii(const string& s) ATTRIBUTE_PURE;
+static bool is_ascii(const string& s) {
+	for(string::const_iterator it(s.begin()); likely(it != s.end()); ++it) {
+		if(static_cast<unsigned char>(*it) >= 0x80U) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+If the search strings of a literal algorithm without anchor contain no
+space, a string of words matches if and only if one of the words does.
+Otherwise, each alternative of algorithm->literals() provides a string
+without spaces which some word must contain up to case. To avoid
+locale-dependent case folding, words with non-ASCII bytes always pass.
+**/
+void PackageTest::prepare_depend_words() const {
+	depend_mode = DEPEND_STRINGS;
+	if(!algorithm->stateless()) {
+		return;
+	}
+	bool words(false);
+	LiteralAlgorithm::Anchor anchor;
+	if(literal_anchor(algorithm, &anchor) && (anchor == LiteralAlgorithm::ANCHOR_NONE)) {
+		WordVec strings;
+		algorithm->getStrings(&strings);
+		words = true;
+		for(WordVec::const_iterator it(strings.begin()); likely(it != strings.end()); ++it) {
+			if(it->find(' ') != string::npos) {
+				words = false;
+				break;
+			}
+		}
+	}
+	vector<StringMatcher> filter;
+	if(!words) {
+		vector<WordVec> alternatives;
+		if(!algorithm->literals(&alternatives)) {
+			return;
+		}
+		for(vector<WordVec>::const_iterator alt(alternatives.begin());
+			likely(alt != alternatives.end()); ++alt) {
+			const string *best(NULLPTR);
+			for(WordVec::const_iterator it(alt->begin()); likely(it != alt->end()); ++it) {
+				if(it->empty() || (it->find(' ') != string::npos) || !is_ascii(*it)) {
+					continue;
+				}
+				if((best == NULLPTR) || (it->size() > best->size())) {
+					best = &(*it);
+				}
+			}
+			if(best == NULLPTR) {
+				return;
+			}
+			filter.push_back(StringMatcher());
+			filter.back().set_pattern(*best, true);
+		}
+	}
+	const StringHash& hash(header->depend_hash);
+	StringHash::size_type size(hash.size());
+	depend_words.assign(size, false);
+	depend_same = size;
+	string word;
+	for(StringHash::size_type i(0); likely(i != size); ++i) {
+		hash.get(&word, i);
+		if(unlikely(word == "\"")) {
+			depend_same = i;
+		}
+		if(words) {
+			depend_words[i] = (*algorithm)(word.c_str(), NULLPTR);
+			continue;
+		}
+		if(!is_ascii(word)) {
+			depend_words[i] = true;
+			continue;
+		}
+		for(vector<StringMatcher>::const_iterator it(filter.begin());
+			likely(it != filter.end()); ++it) {
+			if(it->contains(word.c_str())) {
+				depend_words[i] = true;
+				break;
+			}
+		}
+	}
+	depend_empty_match = (*algorithm)("", NULLPTR);
+	depend_mode = (words ? DEPEND_WORDS : DEPEND_FILTER);
+}
+
+bool PackageTest::dependMatch(const Depend& dep, MatchField which, Package *pkg) const {
+	const Depend::WordIds *ids, *same_ids;
+	switch(which) {
+		case DEPEND:
+			ids = &(dep.depend_ids());
+			same_ids = &(dep.rdepend_ids());
+			break;
+		case RDEPEND:
+			ids = &(dep.rdepend_ids());
+			same_ids = &(dep.depend_ids());
+			break;
+		case PDEPEND:
+			ids = &(dep.pdepend_ids());
+			same_ids = NULLPTR;
+			break;
+		default:
+			ids = &(dep.hdepend_ids());
+			same_ids = NULLPTR;
+			break;
+	}
+	bool empty(true), found(false);
+	for(Depend::WordIds::const_iterator it(ids->begin());
+		likely(it != ids->end()) && !found; ++it) {
+		if((*it == depend_same) && (same_ids != NULLPTR)) {
+			// Only the first " is substituted
+			for(Depend::WordIds::const_iterator jt(same_ids->begin());
+				likely(jt != same_ids->end()); ++jt) {
+				empty = false;
+				if(depend_words[*jt]) {
+					found = true;
+					break;
+				}
+			}
+			same_ids = NULLPTR;
+			continue;
+		}
+		empty = false;
+		found = depend_words[*it];
+	}
+	if(depend_mode == DEPEND_WORDS) {
+		return (empty ? depend_empty_match : found);
+	}
+	if(!(empty || found)) {
+		return false;
+	}
+	switch(which) {
+		case DEPEND:
+			return (*algorithm)(dep.get_depend().c_str(), pkg);
+		case RDEPEND:
+			return (*algorithm)(dep.get_rdepend().c_str(), pkg);
+		case PDEPEND:
+			return (*algorithm)(dep.get_pdepend().c_str(), pkg);
+		default:
+			return (*algorithm)(dep.get_hdepend().c_str(), pkg);
+	}
 }
 
 /**
@@ -488,9 +1076,21 @@ bool PackageTest::stringMatch(Package *pkg) const {
 		bool rdepend((field & RDEPEND) != NONE);
 		bool pdepend((field & PDEPEND) != NONE);
 		bool hdepend((field & HDEPEND) != NONE);
+		if(unlikely(depend_mode == DEPEND_UNKNOWN)) {
+			prepare_depend_words();
+		}
 		for(Package::iterator it(pkg->begin());
 			likely(it != pkg->end()); ++it) {
 			const Depend &dep(it->depend);
+			if((depend_mode != DEPEND_STRINGS) && dep.known_ids()) {
+				if((depend && dependMatch(dep, DEPEND, pkg))
+				|| (rdepend && dependMatch(dep, RDEPEND, pkg))
+				|| (pdepend && dependMatch(dep, PDEPEND, pkg))
+				|| (hdepend && dependMatch(dep, HDEPEND, pkg))) {
+					return true;
+				}
+				continue;
+			}
 			if((depend && (*algorithm)(dep.get_depend().c_str(), pkg))
 			|| (rdepend && (*algorithm)(dep.get_rdepend().c_str(), pkg))
 			|| (pdepend && (*algorithm)(dep.get_pdepend().c_str(), pkg))
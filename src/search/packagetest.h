@@ -14,11 +14,13 @@
 #include <string>
 #include <vector>
 
+#include "database/package_index.h"
 #include "database/package_reader.h"
 #include "eixTk/constexpr.h"
 #include "eixTk/inttypes.h"
 #include "eixTk/likely.h"
 #include "eixTk/null.h"
+#include "eixTk/stringutils.h"
 #include "portage/extendedversion.h"
 #include "portage/keywords.h"
 #include "portage/package.h"
@@ -26,6 +28,7 @@
 #include "search/redundancy.h"
 
 class BaseAlgorithm;
+class Depend;
 class Mask;
 class MatcherAlgorithm;
 class MatcherField;
@@ -112,11 +115,51 @@ class PackageTest {
 
 		bool match(PackageReader *pkg) const;
 
+		/**
+		Collect a superset of the matching packages from the index.
+		@return false if this is not possible for the test
+		**/
+		bool select(PackageIndex *index, PackageIndex::Selection *sel) const ATTRIBUTE_NONNULL_;
+
 		/**
 		Set defaults (e.g. matchfield if unspecified), calculate needs
 		**/
 		void finalize();
 
+		/**
+		Can the test other be combined with this test by "or"?
+		This is the case if both are only literal string tests
+		for the same fields with the same anchor.
+		**/
+		bool can_merge(const PackageTest& other) const;
+
+		/**
+		Combine the test other (for which can_merge() holds) with this
+		test by "or" so that all strings are tested at once
+		**/
+		void merge(const PackageTest& other);
+
+		/**
+		Estimate the cost of match() once the package has been read and
+		the fraction of the packages which pass; used to order the tests
+		**/
+		void estimate(double *cost, double *pass) const ATTRIBUTE_NONNULL_;
+
+		/**
+		@return false if match() stores data in the package so that
+		it must not be skipped or called in addition
+		**/
+		bool reorderable() const ATTRIBUTE_PURE;
+
+		/**
+		Describe the test for --explain
+		**/
+		void explain(std::string *s) const ATTRIBUTE_NONNULL_;
+
+		PackageReader::Attributes get_need() const {
+			return need;
+		}
+
 		/*
 		The constructor of the class *must* set the least restrictive choice.
 		Since --selected --world must act like --selected, the less restrictive
@@ -315,6 +358,25 @@ class PackageTest {
 		**/
 		BaseAlgorithm *algorithm;
 
+		/**
+		How the dependencies of the available versions are matched with
+		the aid of the word indices of header->depend_hash:
+		DEPEND_STRINGS: Not at all, the algorithm is applied to the strings.
+		DEPEND_FILTER: A string is passed to the algorithm only if it
+		contains a word marked in depend_words.
+		DEPEND_WORDS: A string matches if it contains a word marked in
+		depend_words or if it is empty and depend_empty_match is set.
+		DEPEND_UNKNOWN: prepare_depend_words() was not called yet.
+		**/
+		enum DependMode { DEPEND_UNKNOWN, DEPEND_STRINGS, DEPEND_FILTER, DEPEND_WORDS };
+		mutable DependMode depend_mode;
+		mutable std::vector<bool> depend_words;
+		mutable bool depend_empty_match;
+		/**
+		The index of the word " in header->depend_hash (or its size)
+		**/
+		mutable StringHash::size_type depend_same;
+
 		/**
 		Other flags for tests
 		**/
@@ -364,6 +426,24 @@ class PackageTest {
 
 		bool stringMatch(Package *pkg) const ATTRIBUTE_NONNULL_;
 
+		/**
+		Evaluate the algorithm once for each entry of header->depend_hash
+		and set depend_mode accordingly
+		**/
+		void prepare_depend_words() const;
+
+		/**
+		Match the dependency string of dep for which, using its word indices
+		**/
+		bool dependMatch(const Depend& dep, MatchField which, Package *pkg) const ATTRIBUTE_NONNULL_;
+
+		/**
+		@return true if there are no tests besides the string test
+		**/
+		bool only_string_test() const ATTRIBUTE_PURE;
+
+		bool select_hash(PackageIndex *index, PackageIndex::Selection *sel, PackageIndex::PostingType type, const StringHash& hash, MatchField which) const ATTRIBUTE_NONNULL((2, 3));
+
 		void setNeeds(const PackageReader::Attributes i) {
 			if(need < i) {
 				need = i;
@@ -527,13 +527,13 @@ void parse_cli(MatchTree *matchtree, EixRc *eixrc, VarDbPkg *varpkg_db, PortageS
 			if(m.parseMask(word->c_str(), &errtext, -1) != BasicVersion::parsedError) {
 				if(unlikely(*marked_list == NULLPTR)) {
 					*marked_list = new MaskList<Mask>;
+					// All masks are in the same list, so one test suffices
+					NEW_TEST;
+					*test = PackageTest::CATEGORY_NAME;
+					test->SetMarkedList(*marked_list);
+					matchtree->set_pipetest(test);
 				}
 				(*marked_list)->add(m);
-
-				NEW_TEST;
-				*test = PackageTest::CATEGORY_NAME;
-				test->SetMarkedList(*marked_list);
-				matchtree->set_pipetest(test);
 			}
 		}
 	}
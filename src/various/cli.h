@@ -96,9 +96,15 @@ enum cli_options {
 	O_INSTALLED_WITHOUT_USE,
 	O_FROM_OVERLAY,
 	O_EIX_CACHEFILE,
+	O_FUZZY_TOP,
+	O_JOBS,
+	O_RDEPENDS,
+	O_BATCH,
 	O_NONVIRTUAL,
 	O_VIRTUAL,
 	O_DEBUG,
+	O_STATS,
+	O_EXPLAIN,
 	O_SEARCH_EAPI,
 	O_SEARCH_INST_EAPI,
 	O_SEARCH_SLOT,